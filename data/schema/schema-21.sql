@@ -0,0 +1,3 @@
+ALTER TABLE subdirectories ADD COLUMN fingerprint TEXT;
+
+UPDATE schema_version SET version=21;
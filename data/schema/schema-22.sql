@@ -0,0 +1,9 @@
+CREATE INDEX IF NOT EXISTS idx_directory_id ON songs (directory_id);
+
+CREATE INDEX IF NOT EXISTS idx_effective_albumartist_album ON songs (effective_albumartist, album);
+
+CREATE INDEX IF NOT EXISTS idx_song_id ON songs (song_id);
+
+CREATE INDEX IF NOT EXISTS idx_fingerprint ON songs (fingerprint);
+
+UPDATE schema_version SET version=22;
@@ -4,7 +4,7 @@ CREATE TABLE IF NOT EXISTS schema_version (
 
 DELETE FROM schema_version;
 
-INSERT INTO schema_version (version) VALUES (20);
+INSERT INTO schema_version (version) VALUES (22);
 
 CREATE TABLE IF NOT EXISTS directories (
   path TEXT NOT NULL,
@@ -14,7 +14,8 @@ CREATE TABLE IF NOT EXISTS directories (
 CREATE TABLE IF NOT EXISTS subdirectories (
   directory_id INTEGER NOT NULL,
   path TEXT NOT NULL,
-  mtime INTEGER NOT NULL
+  mtime INTEGER NOT NULL,
+  fingerprint TEXT
 );
 
 CREATE TABLE IF NOT EXISTS songs (
@@ -1038,4 +1039,12 @@ CREATE INDEX IF NOT EXISTS idx_album ON songs (album);
 
 CREATE INDEX IF NOT EXISTS idx_title ON songs (title);
 
+CREATE INDEX IF NOT EXISTS idx_directory_id ON songs (directory_id);
+
+CREATE INDEX IF NOT EXISTS idx_effective_albumartist_album ON songs (effective_albumartist, album);
+
+CREATE INDEX IF NOT EXISTS idx_song_id ON songs (song_id);
+
+CREATE INDEX IF NOT EXISTS idx_fingerprint ON songs (fingerprint);
+
 CREATE VIEW IF NOT EXISTS duplicated_songs as select artist dup_artist, album dup_album, title dup_title from songs as inner_songs where artist != '' and album != '' and title != '' and unavailable = 0 group by artist, album , title having count(*) > 1;
@@ -67,9 +67,33 @@ AnalyzerBase::~AnalyzerBase() {
   delete fht_;
 }
 
+void AnalyzerBase::set_engine(SharedPtr<EngineBase> engine) {
+
+  engine_ = engine;
+
+  // No frames are produced while not playing, so don't keep a 25 fps timer awake for a frozen picture.
+  QObject::connect(&*engine, &EngineBase::StateChanged, this, &AnalyzerBase::EngineStateChanged, Qt::UniqueConnection);
+
+}
+
+void AnalyzerBase::EngineStateChanged(const EngineBase::State state) {
+
+  if (state == EngineBase::State::Playing) {
+    if (isVisible() && !timer_.isActive()) timer_.start(timeout(), this);
+  }
+  else if (timer_.isActive()) {
+    // Paint one last frame so the paused state shows, then go idle.
+    update();
+    timer_.stop();
+  }
+
+}
+
 void AnalyzerBase::showEvent(QShowEvent *e) {
   Q_UNUSED(e)
-  timer_.start(timeout(), this);
+  if (!engine_ || engine_->state() == EngineBase::State::Playing) {
+    timer_.start(timeout(), this);
+  }
 }
 
 void AnalyzerBase::hideEvent(QHideEvent *e) {
@@ -89,7 +113,11 @@ void AnalyzerBase::ChangeTimeout(const int timeout) {
 
 void AnalyzerBase::transform(Scope &scope) {
 
-  QList<float> aux(fht_->size());
+  // One FFT pass per frame feeds every consumer of the spectrum; the scratch buffer is reused across frames.
+  if (fht_aux_buffer_.size() != fht_->size()) {
+    fht_aux_buffer_.resize(fht_->size());
+  }
+  QList<float> &aux = fht_aux_buffer_;
   if (static_cast<quint64>(aux.size()) >= scope.size()) {
     std::copy(scope.begin(), scope.end(), aux.begin());
   }
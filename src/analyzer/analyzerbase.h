@@ -31,6 +31,7 @@
 
 #include <vector>
 
+#include <QList>
 #include <QWidget>
 #include <QBasicTimer>
 #include <QString>
@@ -53,12 +54,15 @@ class AnalyzerBase : public QWidget {
 
   int timeout() const { return timeout_; }
 
-  void set_engine(SharedPtr<EngineBase> engine) { engine_ = engine; }
+  void set_engine(SharedPtr<EngineBase> engine);
 
   void ChangeTimeout(const int timeout);
 
   virtual void framerateChanged() {}
 
+ private Q_SLOTS:
+  void EngineStateChanged(const EngineBase::State state);
+
  protected:
   using Scope = std::vector<float>;
   explicit AnalyzerBase(QWidget*, const uint scopeSize = 7);
@@ -81,6 +85,8 @@ class AnalyzerBase : public QWidget {
  protected:
   QBasicTimer timer_;
   FHT *fht_;
+  // Scratch buffer for the FFT pass, kept across frames so transform() doesn't allocate per frame.
+  QList<float> fht_aux_buffer_;
   SharedPtr<EngineBase> engine_;
   Scope lastscope_;
 
@@ -59,6 +59,9 @@ BlockAnalyzer::BlockAnalyzer(QWidget *parent)
       fade_bars_(kFadeSize),
       fade_pos_(1 << 8, 50),
       fade_intensity_(1 << 8, 32),
+      prev_y_(1 << 8, -1),
+      prev_store_(1 << 8, -1),
+      background_dirty_(true),
       step_(0) {
 
   setMinimumSize(kMinColumns * (kWidth + 1) - 1, kMinRows * (kHeight + 1) - 1);  //-1 is padding, no drawing takes place there
@@ -162,8 +165,10 @@ void BlockAnalyzer::analyze(QPainter &p, const Scope &s, const bool new_frame) {
 
   interpolate(s, scope_);
 
-  // Paint the background
-  canvas_painter.drawPixmap(0, 0, background_);
+  if (background_dirty_) {
+    canvas_painter.drawPixmap(0, 0, background_);
+    background_dirty_ = false;
+  }
 
   for (int x = 0, y = 0; x < static_cast<int>(scope_.size()); ++x) {
     // determine y
@@ -185,6 +190,13 @@ void BlockAnalyzer::analyze(QPainter &p, const Scope &s, const bool new_frame) {
       fade_intensity_[x] = kFadeSize;
     }
 
+    // Columns whose bar, fall-off or fade state is unchanged are still correct on the canvas and are skipped.
+    const bool dirty = y != prev_y_.at(x) || static_cast<int>(store_.at(x)) != prev_store_.at(x) || fade_intensity_.at(x) > 0;
+    if (!dirty) continue;
+
+    // Restore the background band for this column before repainting it
+    canvas_painter.drawPixmap(x * (kWidth + 1), 0, background_, x * (kWidth + 1), 0, kWidth + 1, background_.height());
+
     if (fade_intensity_.at(x) > 0) {
       --fade_intensity_[x];
       const int offset = fade_intensity_.value(x);
@@ -196,10 +208,11 @@ void BlockAnalyzer::analyze(QPainter &p, const Scope &s, const bool new_frame) {
 
     // REMEMBER: y is a number from 0 to rows_, 0 means all blocks are glowing, rows_ means none are
     canvas_painter.drawPixmap(x * (kWidth + 1), y * (kHeight + 1) + y_, *bar(), 0, y * (kHeight + 1), bar()->width(), bar()->height());
-  }
 
-  for (int x = 0; x < store_.size(); ++x) {
     canvas_painter.drawPixmap(x * (kWidth + 1), static_cast<int>(store_[x]) * (kHeight + 1) + y_, topbarpixmap_);
+
+    prev_y_[x] = y;
+    prev_store_[x] = static_cast<int>(store_.at(x));
   }
 
   p.drawPixmap(0, 0, canvas_);
@@ -412,4 +425,9 @@ void BlockAnalyzer::drawBackground() {
     }
   }
 
+  // The background changed, the canvas needs a full repaint on the next frame.
+  background_dirty_ = true;
+  prev_y_.fill(-1);
+  prev_store_.fill(-1);
+
 }
@@ -71,6 +71,10 @@ class BlockAnalyzer : public AnalyzerBase {
   QList<QPixmap> fade_bars_;
   QList<int> fade_pos_;
   QList<int> fade_intensity_;
+  // Last painted bar height per column, -1 forces a repaint. Only columns whose state changed are redrawn each frame.
+  QList<int> prev_y_;
+  QList<int> prev_store_;
+  bool background_dirty_;
 
   double step_;  // rows to fall per frame
 };
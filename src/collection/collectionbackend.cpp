@@ -30,6 +30,8 @@
 #include <QThread>
 #include <QMutex>
 #include <QSet>
+#include <QTimer>
+#include <QScopeGuard>
 #include <QMap>
 #include <QList>
 #include <QVariant>
@@ -52,6 +54,9 @@
 #include "core/song.h"
 
 #include "collectiondirectory.h"
+#include "filterparser/filtertosql.h"
+#include "constants/collectionsettings.h"
+#include "core/settings.h"
 #include "collectionbackend.h"
 #include "collectionfilteroptions.h"
 #include "collectionquery.h"
@@ -64,7 +69,9 @@ CollectionBackend::CollectionBackend(QObject *parent)
       db_(nullptr),
       task_manager_(nullptr),
       source_(Song::Source::Unknown),
-      original_thread_(nullptr) {
+      original_thread_(nullptr),
+      fts_index_state_(FTSIndexState::Unknown),
+      timer_flush_playcounts_(nullptr) {
 
   original_thread_ = thread();
 
@@ -87,6 +94,28 @@ void CollectionBackend::Init(SharedPtr<Database> db, SharedPtr<TaskManager> task
   dirs_table_ = dirs_table;
   subdirs_table_ = subdirs_table;
 
+  {
+    Settings settings;
+    settings.beginGroup(CollectionSettings::kSettingsGroup);
+    song_cache_.setMaxCost(settings.value(CollectionSettings::kSongCacheSize, 10000).toInt());
+    settings.endGroup();
+  }
+
+  // Any announced change makes cached songs stale.
+  QObject::connect(this, &CollectionBackend::SongsAdded, this, &CollectionBackend::InvalidateSongCache);
+  QObject::connect(this, &CollectionBackend::SongsChanged, this, &CollectionBackend::InvalidateSongCache);
+  QObject::connect(this, &CollectionBackend::SongsDeleted, this, &CollectionBackend::InvalidateSongCache);
+  QObject::connect(this, &CollectionBackend::SongsStatisticsChanged, this, &CollectionBackend::InvalidateSongCache);
+  QObject::connect(this, &CollectionBackend::SongsRatingChanged, this, &CollectionBackend::InvalidateSongCache);
+  QObject::connect(this, &CollectionBackend::DatabaseReset, this, &CollectionBackend::InvalidateSongCache);
+
+}
+
+void CollectionBackend::InvalidateSongCache() {
+
+  QMutexLocker l(&song_cache_mutex_);
+  song_cache_.clear();
+
 }
 
 void CollectionBackend::Close() {
@@ -285,7 +314,7 @@ CollectionSubdirectoryList CollectionBackend::SubdirsInDirectory(const int id) {
 CollectionSubdirectoryList CollectionBackend::SubdirsInDirectory(const int id, QSqlDatabase &db) {
 
   SqlQuery q(db);
-  q.prepare(QStringLiteral("SELECT path, mtime FROM %1 WHERE directory_id = :dir").arg(subdirs_table_));
+  q.prepare(QStringLiteral("SELECT path, mtime, fingerprint FROM %1 WHERE directory_id = :dir").arg(subdirs_table_));
   q.BindValue(u":dir"_s, id);
   if (!q.Exec()) {
     db_->ReportErrors(q);
@@ -298,6 +327,7 @@ CollectionSubdirectoryList CollectionBackend::SubdirsInDirectory(const int id, Q
     subdir.directory_id = id;
     subdir.path = q.value(0).toString();
     subdir.mtime = q.value(1).toLongLong();
+    subdir.fingerprint = q.value(2).toString();
     subdirs << subdir;
   }
 
@@ -445,6 +475,131 @@ void CollectionBackend::RemoveDirectory(const CollectionDirectory &dir) {
 
 }
 
+void CollectionBackend::BuildFTSIndex() {
+
+  Q_ASSERT(QThread::currentThread() == thread());
+
+  bool available = false;
+  {
+    QMutexLocker l(db_->Mutex());
+    QSqlDatabase db(db_->Connect());
+    available = EnsureFTSIndex(db);
+  }
+
+  fts_index_state_ = available ? FTSIndexState::Available : FTSIndexState::Unavailable;
+
+}
+
+bool CollectionBackend::EnsureFTSIndex(QSqlDatabase &db) {
+
+  // FTS5 may not be compiled into the SQLite library Qt is linked against, so treat failures here as "no index" instead of errors.
+  const QString fts_table = songs_table_ + "_fts5"_L1;
+  const bool existed = db.tables().contains(fts_table);
+
+  static const char *kFTSColumns = "title, album, artist, albumartist, composer, performer, grouping, genre, comment";
+
+  QStringList statements = QStringList()
+    << QStringLiteral("CREATE VIRTUAL TABLE IF NOT EXISTS %1 USING fts5(%2, content='%3', content_rowid='rowid', tokenize='unicode61 remove_diacritics 2')").arg(fts_table, QLatin1String(kFTSColumns), songs_table_)
+    << QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_ai AFTER INSERT ON %2 BEGIN INSERT INTO %1 (rowid, %3) VALUES (new.rowid, new.title, new.album, new.artist, new.albumartist, new.composer, new.performer, new.grouping, new.genre, new.comment); END").arg(fts_table, songs_table_, QLatin1String(kFTSColumns))
+    << QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_ad AFTER DELETE ON %2 BEGIN INSERT INTO %1 (%1, rowid, %3) VALUES ('delete', old.rowid, old.title, old.album, old.artist, old.albumartist, old.composer, old.performer, old.grouping, old.genre, old.comment); END").arg(fts_table, songs_table_, QLatin1String(kFTSColumns))
+    << QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_au AFTER UPDATE ON %2 BEGIN INSERT INTO %1 (%1, rowid, %3) VALUES ('delete', old.rowid, old.title, old.album, old.artist, old.albumartist, old.composer, old.performer, old.grouping, old.genre, old.comment); INSERT INTO %1 (rowid, %3) VALUES (new.rowid, new.title, new.album, new.artist, new.albumartist, new.composer, new.performer, new.grouping, new.genre, new.comment); END").arg(fts_table, songs_table_, QLatin1String(kFTSColumns));
+
+  if (!existed) {
+    // Populate the index from the existing songs.
+    statements << QStringLiteral("INSERT INTO %1 (%1) VALUES ('rebuild')").arg(fts_table);
+  }
+
+  for (const QString &statement : std::as_const(statements)) {
+    SqlQuery q(db);
+    q.prepare(statement);
+    if (!q.Exec()) {
+      qLog(Info) << "FTS5 appears to be unavailable, falling back to in-memory filtering:" << q.lastError().text();
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
+std::optional<QSet<int>> CollectionBackend::SongIdsMatchingSearchText(const QString &text) {
+
+  // This runs on the UI thread per keystroke. The index is built on the backend thread the first time
+  // it is wanted, and a busy database (a scan transaction holding the mutex) falls back to the
+  // in-memory path instead of blocking the keystroke.
+  const FTSIndexState fts_index_state = fts_index_state_.value();
+  if (fts_index_state == FTSIndexState::Unavailable || fts_index_state == FTSIndexState::Building) {
+    return std::nullopt;
+  }
+  if (fts_index_state == FTSIndexState::Unknown) {
+    fts_index_state_ = FTSIndexState::Building;
+    QMetaObject::invokeMethod(this, &CollectionBackend::BuildFTSIndex, Qt::QueuedConnection);
+    return std::nullopt;
+  }
+
+  QRecursiveMutex *mutex = db_->Mutex();
+  if (!mutex->tryLock()) {
+    return std::nullopt;
+  }
+  const QScopeGuard mutex_unlocker = qScopeGuard([mutex]() { mutex->unlock(); });
+
+  QSqlDatabase db(db_->Connect());
+
+  // Each whitespace-separated token must match as a prefix, in any column.
+  static const QRegularExpression regex_whitespace(u"\\s+"_s);
+  const QStringList tokens = text.split(regex_whitespace, Qt::SkipEmptyParts);
+  QStringList terms;
+  terms.reserve(tokens.count());
+  for (const QString &token : tokens) {
+    QString term = token;
+    term.replace(u'"', u"\"\""_s);
+    terms << u'"' + term + u"\"*"_s;
+  }
+  if (terms.isEmpty()) {
+    return std::nullopt;
+  }
+
+  SqlQuery q(db);
+  q.prepare(QStringLiteral("SELECT rowid FROM %1_fts5 WHERE %1_fts5 MATCH :query").arg(songs_table_));
+  q.BindValue(u":query"_s, terms.join(u' '));
+  if (!q.Exec()) {
+    // A malformed MATCH expression is a user input problem, not a database error.
+    return std::nullopt;
+  }
+
+  QSet<int> ids;
+  while (q.next()) {
+    ids << q.value(0).toInt();
+  }
+
+  return ids;
+
+}
+
+std::optional<QSet<int>> CollectionBackend::SongIdsMatchingFilter(const QString &filter_string) {
+
+  const std::optional<QString> where_clause = FilterToSql::Compile(filter_string);
+  if (!where_clause) return std::nullopt;
+
+  QMutexLocker l(db_->Mutex());
+  QSqlDatabase db(db_->Connect());
+
+  SqlQuery q(db);
+  q.prepare(QStringLiteral("SELECT ROWID FROM %1 WHERE unavailable = 0 AND %2").arg(songs_table_, *where_clause));
+  if (!q.Exec()) {
+    db_->ReportErrors(q);
+    return std::nullopt;
+  }
+
+  QSet<int> ids;
+  while (q.next()) {
+    ids << q.value(0).toInt();
+  }
+
+  return ids;
+
+}
+
 SongList CollectionBackend::FindSongsInDirectory(const int id) {
 
   QMutexLocker l(db_->Mutex());
@@ -516,17 +671,30 @@ SongList CollectionBackend::SongsWithMissingLoudnessCharacteristics(const int id
 
 void CollectionBackend::SongPathChanged(const Song &song, const QFileInfo &new_file, const std::optional<int> new_collection_directory_id) {
 
-  // Take a song and update its path
-  Song updated_song = song;
-  updated_song.set_source(source_);
-  updated_song.set_url(QUrl::fromLocalFile(QDir::cleanPath(new_file.filePath())));
-  updated_song.set_basefilename(new_file.fileName());
-  updated_song.InitArtManual();
-  if (updated_song.is_collection_song() && new_collection_directory_id) {
-    updated_song.set_directory_id(new_collection_directory_id.value());
+  SongsPathChanged(SongList() << song, QList<QFileInfo>() << new_file, new_collection_directory_id);
+
+}
+
+void CollectionBackend::SongsPathChanged(const SongList &songs, const QList<QFileInfo> &new_files, const std::optional<int> new_collection_directory_id) {
+
+  Q_ASSERT(songs.count() == new_files.count());
+
+  // Take the songs and update their paths, committed as one batch.
+  SongList updated_songs;
+  updated_songs.reserve(songs.count());
+  for (qint64 i = 0; i < songs.count(); ++i) {
+    Song updated_song = songs[i];
+    updated_song.set_source(source_);
+    updated_song.set_url(QUrl::fromLocalFile(QDir::cleanPath(new_files[i].filePath())));
+    updated_song.set_basefilename(new_files[i].fileName());
+    updated_song.InitArtManual();
+    if (updated_song.is_collection_song() && new_collection_directory_id) {
+      updated_song.set_directory_id(new_collection_directory_id.value());
+    }
+    updated_songs << updated_song;
   }
 
-  AddOrUpdateSongs(SongList() << updated_song);
+  AddOrUpdateSongs(updated_songs);
 
 }
 
@@ -565,8 +733,9 @@ void CollectionBackend::AddOrUpdateSubdirs(const CollectionSubdirectoryList &sub
 
       if (exists) {
         SqlQuery q(db);
-        q.prepare(QStringLiteral("UPDATE %1 SET mtime = :mtime WHERE directory_id = :id AND path = :path").arg(subdirs_table_));
+        q.prepare(QStringLiteral("UPDATE %1 SET mtime = :mtime, fingerprint = :fingerprint WHERE directory_id = :id AND path = :path").arg(subdirs_table_));
         q.BindValue(u":mtime"_s, subdir.mtime);
+        q.BindValue(u":fingerprint"_s, subdir.fingerprint);
         q.BindValue(u":id"_s, subdir.directory_id);
         q.BindValue(u":path"_s, subdir.path);
         if (!q.Exec()) {
@@ -576,10 +745,11 @@ void CollectionBackend::AddOrUpdateSubdirs(const CollectionSubdirectoryList &sub
       }
       else {
         SqlQuery q(db);
-        q.prepare(QStringLiteral("INSERT INTO %1 (directory_id, path, mtime) VALUES (:id, :path, :mtime)").arg(subdirs_table_));
+        q.prepare(QStringLiteral("INSERT INTO %1 (directory_id, path, mtime, fingerprint) VALUES (:id, :path, :mtime, :fingerprint)").arg(subdirs_table_));
         q.BindValue(u":id"_s, subdir.directory_id);
         q.BindValue(u":path"_s, subdir.path);
         q.BindValue(u":mtime"_s, subdir.mtime);
+        q.BindValue(u":fingerprint"_s, subdir.fingerprint);
         if (!q.Exec()) {
           db_->ReportErrors(q);
           return;
@@ -628,39 +798,47 @@ void CollectionBackend::AddOrUpdateSongs(const SongList &songs) {
   SongList added_songs;
   SongList changed_songs;
 
+  // The same statements are executed for every song, so prepare them once up front and only re-bind per song.
+  // During an initial import this is the dominant database cost after tag reading.
+  SqlQuery check_dir(db);
+  if (!dirs_table_.isEmpty()) {
+    check_dir.prepare(QStringLiteral("SELECT ROWID FROM %1 WHERE ROWID = :id").arg(dirs_table_));
+  }
+  SqlQuery q_update(db);
+  q_update.prepare(QStringLiteral("UPDATE %1 SET %2 WHERE ROWID = :id").arg(songs_table_, Song::kUpdateSpec));
+  SqlQuery q_insert(db);
+  q_insert.prepare(QStringLiteral("INSERT INTO %1 (%2) VALUES (%3)").arg(songs_table_, Song::kColumnSpec, Song::kBindSpec));
+
+  // Directories rarely change within one batch, so remember the ones already checked.
+  QSet<int> checked_dirs;
+
   for (const Song &song : songs) {
 
     // Do a sanity check first - make sure the song's directory still exists
     // This is to fix a possible race condition when a directory is removed while CollectionWatcher is scanning it.
     if (!dirs_table_.isEmpty()) {
-      SqlQuery check_dir(db);
-      check_dir.prepare(QStringLiteral("SELECT ROWID FROM %1 WHERE ROWID = :id").arg(dirs_table_));
-      check_dir.BindValue(u":id"_s, song.directory_id());
-      if (!check_dir.Exec()) {
-        db_->ReportErrors(check_dir);
-        return;
+      if (!checked_dirs.contains(song.directory_id())) {
+        check_dir.BindValue(u":id"_s, song.directory_id());
+        if (!check_dir.Exec()) {
+          db_->ReportErrors(check_dir);
+          return;
+        }
+        if (!check_dir.next()) continue;
+        checked_dirs << song.directory_id();
       }
-
-      if (!check_dir.next()) continue;
-
     }
 
     if (song.id() != -1) {  // This song exists in the DB.
 
-      // Get the previous song data first
-      Song old_song(GetSongById(song.id()));
-      if (!old_song.is_valid()) continue;
+      // Only the row's existence matters here, fetching the whole previous song per row was the hot cost.
+      if (!SongExists(song.id(), db)) continue;
 
       // Update
-      {
-        SqlQuery q(db);
-        q.prepare(QStringLiteral("UPDATE %1 SET %2 WHERE ROWID = :id").arg(songs_table_, Song::kUpdateSpec));
-        song.BindToQuery(&q);
-        q.BindValue(u":id"_s, song.id());
-        if (!q.Exec()) {
-          db_->ReportErrors(q);
-          return;
-        }
+      song.BindToQuery(&q_update);
+      q_update.BindValue(u":id"_s, song.id());
+      if (!q_update.Exec()) {
+        db_->ReportErrors(q_update);
+        return;
       }
 
       changed_songs << song;
@@ -679,15 +857,11 @@ void CollectionBackend::AddOrUpdateSongs(const SongList &songs) {
         new_song.set_id(old_song.id());
 
         // Update
-        {
-          SqlQuery q(db);
-          q.prepare(QStringLiteral("UPDATE %1 SET %2 WHERE ROWID = :id").arg(songs_table_, Song::kUpdateSpec));
-          new_song.BindToQuery(&q);
-          q.BindValue(u":id"_s, new_song.id());
-          if (!q.Exec()) {
-            db_->ReportErrors(q);
-            return;
-          }
+        new_song.BindToQuery(&q_update);
+        q_update.BindValue(u":id"_s, new_song.id());
+        if (!q_update.Exec()) {
+          db_->ReportErrors(q_update);
+          return;
         }
 
         changed_songs << new_song;
@@ -698,18 +872,14 @@ void CollectionBackend::AddOrUpdateSongs(const SongList &songs) {
 
     // Create new song
 
-    int id = -1;
-    {  // Insert the row and create a new ID
-      SqlQuery q(db);
-      q.prepare(QStringLiteral("INSERT INTO %1 (%2) VALUES (%3)").arg(songs_table_, Song::kColumnSpec, Song::kBindSpec));
-      song.BindToQuery(&q);
-      if (!q.Exec()) {
-        db_->ReportErrors(q);
-        return;
-      }
-      // Get the new ID
-      id = q.lastInsertId().toInt();
+    // Insert the row and create a new ID
+    song.BindToQuery(&q_insert);
+    if (!q_insert.Exec()) {
+      db_->ReportErrors(q_insert);
+      return;
     }
+    // Get the new ID
+    const int id = q_insert.lastInsertId().toInt();
 
     if (id == -1) return;
 
@@ -755,6 +925,14 @@ void CollectionBackend::UpdateSongsBySongID(const SongMap &new_songs) {
     }
   }
 
+  // The same statements run for every added, changed and removed song, prepare them once.
+  SqlQuery q_update(db);
+  q_update.prepare(QStringLiteral("UPDATE %1 SET %2 WHERE ROWID = :id").arg(songs_table_, Song::kUpdateSpec));
+  SqlQuery q_insert(db);
+  q_insert.prepare(QStringLiteral("INSERT INTO %1 (%2) VALUES (%3)").arg(songs_table_, Song::kColumnSpec, Song::kBindSpec));
+  SqlQuery q_delete(db);
+  q_delete.prepare(QStringLiteral("DELETE FROM %1 WHERE ROWID = :id").arg(songs_table_));
+
   // Add or update songs.
   const QList new_songs_list = new_songs.values();
   for (const Song &new_song : new_songs_list) {
@@ -764,15 +942,11 @@ void CollectionBackend::UpdateSongsBySongID(const SongMap &new_songs) {
 
       if (!new_song.IsAllMetadataEqual(old_song) || !new_song.IsFingerprintEqual(old_song)) {  // Update existing song.
 
-        {
-          SqlQuery q(db);
-          q.prepare(QStringLiteral("UPDATE %1 SET %2 WHERE ROWID = :id").arg(songs_table_, Song::kUpdateSpec));
-          new_song.BindToQuery(&q);
-          q.BindValue(u":id"_s, old_song.id());
-          if (!q.Exec()) {
-            db_->ReportErrors(q);
-            return;
-          }
+        new_song.BindToQuery(&q_update);
+        q_update.BindValue(u":id"_s, old_song.id());
+        if (!q_update.Exec()) {
+          db_->ReportErrors(q_update);
+          return;
         }
 
         Song new_song_copy(new_song);
@@ -783,18 +957,13 @@ void CollectionBackend::UpdateSongsBySongID(const SongMap &new_songs) {
 
     }
     else {  // Add new song
-      int id = -1;
-      {
-        SqlQuery q(db);
-        q.prepare(QStringLiteral("INSERT INTO %1 (%2) VALUES (%3)").arg(songs_table_, Song::kColumnSpec, Song::kBindSpec));
-        new_song.BindToQuery(&q);
-        if (!q.Exec()) {
-          db_->ReportErrors(q);
-          return;
-        }
-        // Get the new ID
-        id = q.lastInsertId().toInt();
+      new_song.BindToQuery(&q_insert);
+      if (!q_insert.Exec()) {
+        db_->ReportErrors(q_insert);
+        return;
       }
+      // Get the new ID
+      const int id = q_insert.lastInsertId().toInt();
 
       if (id == -1) return;
 
@@ -809,11 +978,9 @@ void CollectionBackend::UpdateSongsBySongID(const SongMap &new_songs) {
   for (const Song &old_song : old_songs_list) {
     if (!new_songs.contains(old_song.song_id())) {
       {
-        SqlQuery q(db);
-        q.prepare(QStringLiteral("DELETE FROM %1 WHERE ROWID = :id").arg(songs_table_));
-        q.BindValue(u":id"_s, old_song.id());
-        if (!q.Exec()) {
-          db_->ReportErrors(q);
+        q_delete.BindValue(u":id"_s, old_song.id());
+        if (!q_delete.Exec()) {
+          db_->ReportErrors(q_delete);
           return;
         }
       }
@@ -835,13 +1002,15 @@ void CollectionBackend::UpdateSongsBySongID(const SongMap &new_songs) {
 
 void CollectionBackend::UpdateMTimesOnly(const SongList &songs) {
 
+  InvalidateSongCache();
+
   QMutexLocker l(db_->Mutex());
   QSqlDatabase db(db_->Connect());
 
   ScopedTransaction transaction(&db);
+  SqlQuery q(db);
+  q.prepare(QStringLiteral("UPDATE %1 SET mtime = :mtime WHERE ROWID = :id").arg(songs_table_));
   for (const Song &song : songs) {
-    SqlQuery q(db);
-    q.prepare(QStringLiteral("UPDATE %1 SET mtime = :mtime WHERE ROWID = :id").arg(songs_table_));
     q.BindValue(u":mtime"_s, song.mtime());
     q.BindValue(u":id"_s, song.id());
     if (!q.Exec()) {
@@ -1073,9 +1242,23 @@ bool CollectionBackend::ExecCollectionQuery(CollectionQuery *query, SongMap &son
 
 Song CollectionBackend::GetSongById(const int id) {
 
+  {
+    QMutexLocker l(&song_cache_mutex_);
+    if (const Song *cached_song = song_cache_.object(id)) {
+      return *cached_song;
+    }
+  }
+
   QMutexLocker l(db_->Mutex());
   QSqlDatabase db(db_->Connect());
-  return GetSongById(id, db);
+  Song song = GetSongById(id, db);
+
+  if (song.is_valid()) {
+    QMutexLocker song_cache_locker(&song_cache_mutex_);
+    song_cache_.insert(id, new Song(song));
+  }
+
+  return song;
 
 }
 
@@ -1129,11 +1312,40 @@ SongList CollectionBackend::GetSongsByForeignId(const QStringList &ids, const QS
 
 }
 
+bool CollectionBackend::SongExists(const int id, QSqlDatabase &db) {
+
+  SqlQuery *q = db_->CachedQuery(db, QStringLiteral("SELECT ROWID FROM %1 WHERE ROWID = :id").arg(songs_table_));
+  q->BindValue(u":id"_s, id);
+  if (!q->Exec()) {
+    db_->ReportErrors(*q);
+    return false;
+  }
+  const bool exists = q->next();
+  q->finish();
+
+  return exists;
+
+}
+
 Song CollectionBackend::GetSongById(const int id, QSqlDatabase &db) {
 
-  SongList list = GetSongsById(QStringList() << QString::number(id), db);
-  if (list.isEmpty()) return Song();
-  return list.first();
+  // This runs once per song in the update paths, use the per-connection statement cache.
+  SqlQuery *q = db_->CachedQuery(db, QStringLiteral("SELECT %1 FROM %2 WHERE ROWID = :id").arg(Song::kRowIdColumnSpec, songs_table_));
+  q->BindValue(u":id"_s, id);
+  if (!q->Exec()) {
+    db_->ReportErrors(*q);
+    return Song();
+  }
+  if (!q->next()) {
+    q->finish();
+    return Song();
+  }
+
+  Song song(source_);
+  song.InitFromQuery(*q, true);
+  q->finish();
+
+  return song;
 
 }
 
@@ -1422,37 +1634,39 @@ void CollectionBackend::CompilationsNeedUpdating() {
 
 bool CollectionBackend::UpdateCompilations(const QSqlDatabase &db, SongList &changed_songs, const QUrl &url, const bool compilation_detected) {
 
+  // This runs once per song of every album whose compilation state flipped, so both statements come from
+  // the per-connection cache instead of being prepared per URL.
+
   {  // Get song, so we can tell the model its updated
-    SqlQuery q(db);
-    q.prepare(QStringLiteral("SELECT %1 FROM %2 WHERE (url = :url1 OR url = :url2 OR url = :url3 OR url = :url4) AND unavailable = 0").arg(Song::kRowIdColumnSpec, songs_table_));
-    q.BindValue(u":url1"_s, url.toString());
-    q.BindValue(u":url2"_s, url.toString(QUrl::FullyEncoded));
-    q.BindValue(u":url3"_s, url.toEncoded(QUrl::FullyDecoded));
-    q.BindValue(u":url4"_s, url.toEncoded(QUrl::FullyEncoded));
-    if (q.Exec()) {
-      while (q.next()) {
+    SqlQuery *q = db_->CachedQuery(db, QStringLiteral("SELECT %1 FROM %2 WHERE (url = :url1 OR url = :url2 OR url = :url3 OR url = :url4) AND unavailable = 0").arg(Song::kRowIdColumnSpec, songs_table_));
+    q->BindValue(u":url1"_s, url.toString());
+    q->BindValue(u":url2"_s, url.toString(QUrl::FullyEncoded));
+    q->BindValue(u":url3"_s, url.toEncoded(QUrl::FullyDecoded));
+    q->BindValue(u":url4"_s, url.toEncoded(QUrl::FullyEncoded));
+    if (q->Exec()) {
+      while (q->next()) {
         Song song(source_);
-        song.InitFromQuery(q, true);
+        song.InitFromQuery(*q, true);
         song.set_compilation_detected(compilation_detected);
         changed_songs << song;
       }
+      q->finish();
     }
     else {
-      db_->ReportErrors(q);
+      db_->ReportErrors(*q);
       return false;
     }
   }
 
   // Update the song
-  SqlQuery q(db);
-  q.prepare(QStringLiteral("UPDATE %1 SET compilation_detected = :compilation_detected, compilation_effective = ((compilation OR :compilation_detected OR compilation_on) AND NOT compilation_off) + 0 WHERE (url = :url1 OR url = :url2 OR url = :url3 OR url = :url4) AND unavailable = 0").arg(songs_table_));
-  q.BindValue(u":compilation_detected"_s, static_cast<int>(compilation_detected));
-  q.BindValue(u":url1"_s, url.toString());
-  q.BindValue(u":url2"_s, url.toString(QUrl::FullyEncoded));
-  q.BindValue(u":url3"_s, url.toEncoded(QUrl::FullyDecoded));
-  q.BindValue(u":url4"_s, url.toEncoded(QUrl::FullyEncoded));
-  if (!q.Exec()) {
-    db_->ReportErrors(q);
+  SqlQuery *q = db_->CachedQuery(db, QStringLiteral("UPDATE %1 SET compilation_detected = :compilation_detected, compilation_effective = ((compilation OR :compilation_detected OR compilation_on) AND NOT compilation_off) + 0 WHERE (url = :url1 OR url = :url2 OR url = :url3 OR url = :url4) AND unavailable = 0").arg(songs_table_));
+  q->BindValue(u":compilation_detected"_s, static_cast<int>(compilation_detected));
+  q->BindValue(u":url1"_s, url.toString());
+  q->BindValue(u":url2"_s, url.toString(QUrl::FullyEncoded));
+  q->BindValue(u":url3"_s, url.toEncoded(QUrl::FullyDecoded));
+  q->BindValue(u":url4"_s, url.toEncoded(QUrl::FullyEncoded));
+  if (!q->Exec()) {
+    db_->ReportErrors(*q);
     return false;
   }
 
@@ -1482,23 +1696,43 @@ CollectionBackend::AlbumList CollectionBackend::GetAlbums(const QString &artist,
     return AlbumList();
   }
 
+  // Most rows belong to an album that's already summarized, so compute the key first
+  // and only materialize the full album info for the first row of each album.
   QMap<QString, Album> albums;
   while (query.Next()) {
 
-    Album album_info;
-    QUrl url = QUrl::fromEncoded(query.Value(0).toByteArray());
-
-    album_info.filetype = static_cast<Song::FileType>(query.Value(1).toInt());
-    const QString filetype = Song::TextForFiletype(album_info.filetype);
-    album_info.cue_path = query.Value(2).toString();
-
+    const QUrl url = QUrl::fromEncoded(query.Value(0).toByteArray());
+    const Song::FileType filetype_enum = static_cast<Song::FileType>(query.Value(1).toInt());
+    const QString filetype = Song::TextForFiletype(filetype_enum);
     const bool is_compilation = query.Value(5).toBool();
-    if (!is_compilation) {
-      album_info.album_artist = query.Value(3).toString();
+    const QString album_artist = is_compilation ? QString() : query.Value(3).toString();
+    const QString album = query.Value(4).toString();
+
+    QString key;
+    if (!album_artist.isEmpty()) {
+      key.append(album_artist);
+    }
+    if (!album.isEmpty()) {
+      if (!key.isEmpty()) key.append(u'-');
+      key.append(album);
+    }
+    if (!filetype.isEmpty()) {
+      key.append(filetype);
     }
 
-    album_info.album = query.Value(4).toString();
+    if (key.isEmpty()) continue;
+
+    QMap<QString, Album>::iterator it = albums.find(key);
+    if (it != albums.end()) {
+      it.value().urls.append(url);
+      continue;
+    }
 
+    Album album_info;
+    album_info.filetype = filetype_enum;
+    album_info.cue_path = query.Value(2).toString();
+    album_info.album_artist = album_artist;
+    album_info.album = album;
     album_info.art_embedded = query.Value(6).toBool();
 
     const QString art_automatic = query.Value(7).toString();
@@ -1520,27 +1754,8 @@ CollectionBackend::AlbumList CollectionBackend::GetAlbums(const QString &artist,
 
     album_info.art_unset = query.Value(9).toBool();
 
-    QString key;
-    if (!album_info.album_artist.isEmpty()) {
-      key.append(album_info.album_artist);
-    }
-    if (!album_info.album.isEmpty()) {
-      if (!key.isEmpty()) key.append(u'-');
-      key.append(album_info.album);
-    }
-    if (!filetype.isEmpty()) {
-      key.append(filetype);
-    }
-
-    if (key.isEmpty()) continue;
-
-    if (albums.contains(key)) {
-      albums[key].urls.append(url);
-    }
-    else {
-      album_info.urls << url;
-      albums.insert(key, album_info);
-    }
+    album_info.urls << url;
+    albums.insert(key, album_info);
 
   }
 
@@ -2014,27 +2229,62 @@ void CollectionBackend::UpdateLastPlayed(const QString &artist, const QString &a
 
 void CollectionBackend::UpdatePlayCount(const QString &artist, const QString &title, const int playcount, const bool save_tags) {
 
-  const SongList songs = GetSongsBy(artist, QString(), title);
-  if (songs.isEmpty()) {
-    qLog(Debug) << "Could not find a matching song in the database for" << artist << title;
-    return;
+  // Imports fire this once per track; batch the updates and flush them in one transaction shortly after the burst.
+  pending_playcount_updates_ << PendingPlayCountUpdate{artist, title, playcount, save_tags};
+
+  if (!timer_flush_playcounts_) {
+    timer_flush_playcounts_ = new QTimer(this);
+    timer_flush_playcounts_->setSingleShot(true);
+    timer_flush_playcounts_->setInterval(500);
+    QObject::connect(timer_flush_playcounts_, &QTimer::timeout, this, &CollectionBackend::FlushPlayCountUpdates);
+  }
+  if (!timer_flush_playcounts_->isActive()) {
+    timer_flush_playcounts_->start();
   }
 
-  QMutexLocker l(db_->Mutex());
-  QSqlDatabase db(db_->Connect());
+}
+
+void CollectionBackend::FlushPlayCountUpdates() {
+
+  const QList<PendingPlayCountUpdate> updates = pending_playcount_updates_;
+  pending_playcount_updates_.clear();
+  if (updates.isEmpty()) return;
+
+  SongList changed_songs;
+  SongList changed_songs_save_tags;
+
+  {
+    QMutexLocker l(db_->Mutex());
+    QSqlDatabase db(db_->Connect());
+
+    ScopedTransaction transaction(&db);
 
-  for (const Song &song : songs) {
     SqlQuery q(db);
     q.prepare(QStringLiteral("UPDATE %1 SET playcount = :playcount WHERE ROWID = :id").arg(songs_table_));
-    q.BindValue(u":playcount"_s, playcount);
-    q.BindValue(u":id"_s, song.id());
-    if (!q.Exec()) {
-      db_->ReportErrors(q);
-      return;
+
+    for (const PendingPlayCountUpdate &update : updates) {
+      const SongList songs = GetSongsBy(update.artist, QString(), update.title);
+      if (songs.isEmpty()) {
+        qLog(Debug) << "Could not find a matching song in the database for" << update.artist << update.title;
+        continue;
+      }
+      for (const Song &song : songs) {
+        q.BindValue(u":playcount"_s, update.playcount);
+        q.BindValue(u":id"_s, song.id());
+        if (!q.Exec()) {
+          db_->ReportErrors(q);
+          return;
+        }
+      }
+      if (update.save_tags) changed_songs_save_tags << songs;
+      else changed_songs << songs;
     }
+
+    transaction.Commit();
   }
 
-  Q_EMIT SongsStatisticsChanged(SongList() << songs, save_tags);
+  if (!changed_songs.isEmpty()) Q_EMIT SongsStatisticsChanged(changed_songs, false);
+  if (!changed_songs_save_tags.isEmpty()) Q_EMIT SongsStatisticsChanged(changed_songs_save_tags, true);
 
 }
 
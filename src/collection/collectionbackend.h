@@ -31,18 +31,23 @@
 #include <QObject>
 #include <QFileInfo>
 #include <QList>
+#include <QSet>
+#include <QCache>
+#include <QMutex>
 #include <QString>
 #include <QStringList>
 #include <QUrl>
 #include <QSqlDatabase>
 
 #include "includes/shared_ptr.h"
+#include "includes/mutex_protected.h"
 #include "core/song.h"
 #include "collectionfilteroptions.h"
 #include "collectionquery.h"
 #include "collectiondirectory.h"
 
 class QThread;
+class QTimer;
 class TaskManager;
 class Database;
 
@@ -170,6 +175,13 @@ class CollectionBackend : public CollectionBackendInterface {
   void UpdateTotalArtistCountAsync() override;
   void UpdateTotalAlbumCountAsync() override;
 
+  // Returns the ids of songs matching the given search text using the FTS5 index.
+  // Returns std::nullopt while the index is still being built on the backend thread, when FTS5 is
+  // unavailable, or when the database is busy, so the caller falls back to in-memory filtering.
+  std::optional<QSet<int>> SongIdsMatchingSearchText(const QString &text);
+  // Resolves a field-syntax filter to matching song ids by compiling it to SQL, or std::nullopt when it can't be pushed down.
+  std::optional<QSet<int>> SongIdsMatchingFilter(const QString &filter_string);
+
   SongList FindSongsInDirectory(const int id) override;
   SongList SongsWithMissingFingerprint(const int id) override;
   SongList SongsWithMissingLoudnessCharacteristics(const int id) override;
@@ -262,10 +274,12 @@ class CollectionBackend : public CollectionBackendInterface {
   bool ResetPlayStatistics(const QStringList &id_str_list);
   void DeleteAll();
   void SongPathChanged(const Song &song, const QFileInfo &new_file, const std::optional<int> new_collection_directory_id);
+  void SongsPathChanged(const SongList &songs, const QList<QFileInfo> &new_files, const std::optional<int> new_collection_directory_id);
 
   SongList GetSongsBy(const QString &artist, const QString &album, const QString &title);
   void UpdateLastPlayed(const QString &artist, const QString &album, const QString &title, const qint64 lastplayed);
   void UpdatePlayCount(const QString &artist, const QString &title, const int playcount, const bool save_tags = false);
+  void FlushPlayCountUpdates();
 
   void UpdateSongRating(const int id, const float rating, const bool save_tags = false);
   void UpdateSongsRating(const QList<int> &id_list, const float rating, const bool save_tags = false);
@@ -305,12 +319,19 @@ class CollectionBackend : public CollectionBackendInterface {
     int has_not_compilation_detected;
   };
 
+  bool EnsureFTSIndex(QSqlDatabase &db);
+  void BuildFTSIndex();
+
   bool UpdateCompilations(const QSqlDatabase &db, SongList &changed_songs, const QUrl &url, const bool compilation_detected);
   AlbumList GetAlbums(const QString &artist, const QString &album_artist, const bool compilation_required = false, const CollectionFilterOptions &opt = CollectionFilterOptions());
   AlbumList GetAlbums(const QString &artist, const bool compilation_required, const CollectionFilterOptions &opt = CollectionFilterOptions());
   CollectionSubdirectoryList SubdirsInDirectory(const int id, QSqlDatabase &db);
 
   Song GetSongById(const int id, QSqlDatabase &db);
+  // Cheap existence probe used in hot update paths where the full song row isn't needed.
+  bool SongExists(const int id, QSqlDatabase &db);
+
+  void InvalidateSongCache();
   SongList GetSongsById(const QStringList &ids, QSqlDatabase &db);
 
   Song GetSongBySongId(const QString &song_id, QSqlDatabase &db);
@@ -324,6 +345,23 @@ class CollectionBackend : public CollectionBackendInterface {
   QString dirs_table_;
   QString subdirs_table_;
   QThread *original_thread_;
+
+  enum class FTSIndexState { Unknown, Building, Available, Unavailable };
+  mutex_protected<FTSIndexState> fts_index_state_;
+
+  // Imports call UpdatePlayCount once per track; the updates are batched and flushed in one transaction.
+  struct PendingPlayCountUpdate {
+    QString artist;
+    QString title;
+    int playcount;
+    bool save_tags;
+  };
+  QList<PendingPlayCountUpdate> pending_playcount_updates_;
+  QTimer *timer_flush_playcounts_;
+
+  // LRU cache over GetSongById, sized by the collection cache setting and dropped whenever songs change.
+  mutable QCache<int, Song> song_cache_;
+  mutable QMutex song_cache_mutex_;
 };
 
 #endif  // COLLECTIONBACKEND_H
@@ -48,6 +48,8 @@ struct CollectionSubdirectory {
   int directory_id;
   QString path;
   qint64 mtime;
+  // Hash of the names, mtimes and sizes of the entries in this subdirectory, used to skip unchanged subdirectories on rescan.
+  QString fingerprint;
 };
 Q_DECLARE_METATYPE(CollectionSubdirectory)
 
@@ -25,6 +25,7 @@
 #include <QSet>
 #include <QList>
 #include <QString>
+#include <QStringList>
 #include <QUrl>
 
 #include "core/song.h"
@@ -59,6 +60,10 @@ bool CollectionFilter::filterAcceptsRow(const int source_row, const QModelIndex
     return item->type == CollectionItem::Type::LoadingIndicator;
   }
 
+  if (fts_song_ids_.has_value()) {
+    return item->metadata.is_valid() && fts_song_ids_->contains(item->metadata.id());
+  }
+
   size_t hash = qHash(filter_string_);
   if (hash != query_hash_) {
     FilterParser p(filter_string_);
@@ -70,9 +75,48 @@ bool CollectionFilter::filterAcceptsRow(const int source_row, const QModelIndex
 
 }
 
+namespace {
+
+// Field syntax like rating:>=4 and quoted phrases are handled by FilterParser, only plain search terms go through the FTS index.
+bool ContainsOnlyPlainSearchTerms(const QString &filter_string) {
+
+  if (filter_string.contains(u':') ||
+      filter_string.contains(u'=') ||
+      filter_string.contains(u'<') ||
+      filter_string.contains(u'>') ||
+      filter_string.contains(u'"') ||
+      filter_string.contains(u'(')) {
+    return false;
+  }
+
+  // FilterParser negates "-term", but FTS5 would match the quoted token positively, so exclusions take the parser path.
+  const QStringList tokens = filter_string.split(u' ', Qt::SkipEmptyParts);
+  for (const QString &token : tokens) {
+    if (token.startsWith(u'-')) return false;
+  }
+
+  return true;
+
+}
+
+}  // namespace
+
 void CollectionFilter::SetFilterString(const QString &filter_string) {
 
   filter_string_ = filter_string;
+
+  fts_song_ids_.reset();
+  CollectionModel *model = qobject_cast<CollectionModel*>(sourceModel());
+  if (model && model->backend() && !filter_string.isEmpty()) {
+    if (ContainsOnlyPlainSearchTerms(filter_string)) {
+      fts_song_ids_ = model->backend()->SongIdsMatchingSearchText(filter_string);
+    }
+    // Field syntax is compiled to SQL and resolved by the database where possible.
+    if (!fts_song_ids_.has_value()) {
+      fts_song_ids_ = model->backend()->SongIdsMatchingFilter(filter_string);
+    }
+  }
+
   setFilterFixedString(filter_string);
 
 }
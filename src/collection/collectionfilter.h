@@ -22,6 +22,8 @@
 
 #include "config.h"
 
+#include <optional>
+
 #include <QSortFilterProxyModel>
 #include <QScopedPointer>
 #include <QSet>
@@ -53,6 +55,9 @@ class CollectionFilter : public QSortFilterProxyModel {
   mutable QScopedPointer<FilterTree> filter_tree_;
   mutable size_t query_hash_;
   QString filter_string_;
+  // Song ids matching the current filter string according to the backend's FTS5 index.
+  // Unset when the filter uses field syntax or FTS5 is unavailable, in which case the filter tree is evaluated per song.
+  std::optional<QSet<int>> fts_song_ids_;
 };
 
 #endif  // COLLECTIONFILTER_H
@@ -34,6 +34,10 @@
 #include <QFuture>
 #include <QFutureWatcher>
 #include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <QSqlRecord>
+#include <QSqlField>
 #include <QMimeData>
 #include <QIODevice>
 #include <QList>
@@ -52,10 +56,12 @@
 #include <QSettings>
 #include <QStandardPaths>
 #include <QTimer>
+#include <QElapsedTimer>
 
 #include "includes/scoped_ptr.h"
 #include "includes/shared_ptr.h"
 #include "core/database.h"
+#include "core/trace.h"
 #include "core/iconloader.h"
 #include "core/logging.h"
 #include "core/settings.h"
@@ -96,6 +102,9 @@ CollectionModel::CollectionModel(const SharedPtr<CollectionBackend> backend, con
       total_artist_count_(0),
       total_album_count_(0),
       loading_(false),
+      snapshot_load_attempted_(false),
+      sql_chunks_started_(false),
+      fast_scrolling_(false),
       icon_disk_cache_(new QNetworkDiskCache(this)) {
 
   setObjectName(backend_->source() == Song::Source::Collection ? QLatin1String(metaObject()->className()) : QStringLiteral("%1%2").arg(Song::DescriptionForSource(backend_->source()), QLatin1String(metaObject()->className())));
@@ -194,6 +203,7 @@ void CollectionModel::EndReset() {
 void CollectionModel::Reload() {
 
   loading_ = true;
+  sql_chunks_started_ = false;
   if (timer_reload_->isActive()) {
     timer_reload_->stop();
   }
@@ -207,6 +217,13 @@ void CollectionModel::Reload() {
   loading->display_text = tr("Loading...");
   EndReset();
 
+  // On the first load, populate the model from the snapshot of the previous session right away.
+  // The SQL load below replaces it with authoritative data when it finishes.
+  if (!snapshot_load_attempted_) {
+    snapshot_load_attempted_ = true;
+    LoadSongsFromSnapshotAsync();
+  }
+
   LoadSongsFromSqlAsync();
 
 }
@@ -476,25 +493,34 @@ void CollectionModel::ProcessUpdate() {
     return;
   }
 
-  const CollectionModelUpdate update = updates_.dequeue();
+  // Apply as many queued batches as fit in a frame's worth of time, so a big import
+  // drains in a few ticks instead of trickling one batch per timer interval.
+  QElapsedTimer tick_timer;
+  tick_timer.start();
+
+  while (!updates_.isEmpty() && tick_timer.elapsed() < 15) {
+
+    const CollectionModelUpdate update = updates_.dequeue();
+
+    switch (update.type) {
+      case CollectionModelUpdate::Type::AddReAddOrUpdate:
+        AddReAddOrUpdateSongsInternal(update.songs);
+        break;
+      case CollectionModelUpdate::Type::Add:
+        AddSongsInternal(update.songs);
+        break;
+      case CollectionModelUpdate::Type::Update:
+        UpdateSongsInternal(update.songs);
+        break;
+      case CollectionModelUpdate::Type::Remove:
+        RemoveSongsInternal(update.songs);
+        break;
+    }
 
-  if (updates_.isEmpty()) {
-    timer_update_->stop();
   }
 
-  switch (update.type) {
-    case CollectionModelUpdate::Type::AddReAddOrUpdate:
-      AddReAddOrUpdateSongsInternal(update.songs);
-      break;
-    case CollectionModelUpdate::Type::Add:
-      AddSongsInternal(update.songs);
-      break;
-    case CollectionModelUpdate::Type::Update:
-      UpdateSongsInternal(update.songs);
-      break;
-    case CollectionModelUpdate::Type::Remove:
-      RemoveSongsInternal(update.songs);
-      break;
+  if (updates_.isEmpty()) {
+    timer_update_->stop();
   }
 
 }
@@ -532,12 +558,10 @@ void CollectionModel::AddReAddOrUpdateSongsInternal(const SongList &songs) {
     }
 
     if (container_key_changed) {
-      qLog(Debug) << "Container key for" << new_song.id() << new_song.PrettyTitleWithArtist() << "is changed, re-adding song.";
       songs_removed << old_song;
       songs_added << new_song;
     }
     else {
-      qLog(Debug) << "Container key for" << new_song.id() << new_song.PrettyTitleWithArtist() << "is uchanged, only updating song metadata.";
       songs_updated << new_song;
     }
   }
@@ -800,16 +824,20 @@ CollectionItem *CollectionModel::CreateCompilationArtistNode(CollectionItem *par
 
 void CollectionModel::LoadSongsFromSqlAsync() {
 
-  QFuture<SongList> future = QtConcurrent::run(&CollectionModel::LoadSongsFromSql, this, options_active_.filter_options);
-  QFutureWatcher<SongList> *watcher = new QFutureWatcher<SongList>();
-  QObject::connect(watcher, &QFutureWatcher<void>::finished, this, &CollectionModel::LoadSongsFromSqlAsyncFinished);
-  watcher->setFuture(future);
+  const quint64 load_generation = load_generation_.fetchAndAddOrdered(1) + 1;
+  (void)QtConcurrent::run(&CollectionModel::LoadSongsFromSql, this, options_active_.filter_options, load_generation);
 
 }
 
-SongList CollectionModel::LoadSongsFromSql(const CollectionFilterOptions &filter_options) {
+void CollectionModel::LoadSongsFromSql(const CollectionFilterOptions &filter_options, const quint64 load_generation) {
 
-  SongList songs;
+  Tracing::ScopedTrace trace("CollectionModel::LoadSongsFromSql");
+
+  // The songs are streamed to the model in bounded chunks while the query iterates,
+  // so the tree starts building immediately and the whole collection is never held in one list.
+  constexpr qint64 kChunkSize = 5000;
+  SongList chunk;
+  bool first_chunk = true;
 
   {
     QMutexLocker l(backend_->db()->Mutex());
@@ -818,9 +846,21 @@ SongList CollectionModel::LoadSongsFromSql(const CollectionFilterOptions &filter
     q.SetColumnSpec(u"%songs_table.ROWID, "_s + Song::kColumnSpec);
     if (q.Exec()) {
       while (q.Next()) {
+        // A newer reload supersedes this one, stop constructing songs for a result that will be discarded.
+        if (load_generation != 0 && load_generation_.loadAcquire() != load_generation) {
+          chunk.clear();
+          break;
+        }
         Song song;
         song.InitFromQuery(q, true);
-        songs << song;
+        chunk << song;
+        if (chunk.count() >= kChunkSize) {
+          const SongList songs_chunk = chunk;
+          const bool reset = first_chunk;
+          QMetaObject::invokeMethod(this, [this, songs_chunk, load_generation, reset]() { AddLoadedSongsChunk(songs_chunk, load_generation, reset); }, Qt::QueuedConnection);
+          chunk.clear();
+          first_chunk = false;
+        }
       }
     }
     else {
@@ -832,26 +872,184 @@ SongList CollectionModel::LoadSongsFromSql(const CollectionFilterOptions &filter
     backend_->db()->Close();
   }
 
+  if (load_generation != 0 && load_generation_.loadAcquire() != load_generation) return;
+
+  const SongList songs_chunk = chunk;
+  const bool reset = first_chunk;
+  QMetaObject::invokeMethod(this, [this, songs_chunk, load_generation, reset]() {
+    AddLoadedSongsChunk(songs_chunk, load_generation, reset);
+    LoadSongsFromSqlFinished(load_generation);
+  }, Qt::QueuedConnection);
+
+}
+
+void CollectionModel::AddLoadedSongsChunk(const SongList &songs, const quint64 load_generation, const bool first_chunk) {
+
+  // Only the newest load may populate the model.
+  if (load_generation != 0 && load_generation_.loadAcquire() != load_generation) return;
+
+  if (first_chunk) {
+    // Replaces the loading indicator or the snapshot contents with the authoritative load.
+    BeginReset();
+    EndReset();
+    sql_chunks_started_ = true;
+    // Let the update queue apply the chunks (and any scan deltas queued behind them) as they arrive.
+    loading_ = false;
+  }
+
+  if (!songs.isEmpty()) {
+    ScheduleAddSongs(songs);
+  }
+
+}
+
+void CollectionModel::LoadSongsFromSqlFinished(const quint64 load_generation) {
+
+  if (load_generation != 0 && load_generation_.loadAcquire() != load_generation) return;
+
+  loading_ = false;
+
+  if (!updates_.isEmpty() && !timer_update_->isActive()) {
+    timer_update_->start();
+  }
+
+  // Only snapshot full loads, otherwise the next startup would come up with a filtered collection.
+  if (options_active_.filter_options.filter_mode() == CollectionFilterOptions::FilterMode::All && options_active_.filter_options.filter_text().isEmpty() && options_active_.filter_options.max_age() == -1) {
+    SaveSnapshotAsync();
+  }
+
+}
+
+QString CollectionModel::SnapshotFilePath() const {
+
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/collection-snapshot-%1.dat").arg(Song::TextForSource(backend_->source()).toLower());
+
+}
+
+namespace {
+constexpr quint32 kSnapshotMagic = 0x53424353;  // "SBCS"
+constexpr quint32 kSnapshotFormatVersion = 1;
+}  // namespace
+
+void CollectionModel::LoadSongsFromSnapshotAsync() {
+
+  QFuture<SongList> future = QtConcurrent::run(&CollectionModel::LoadSongsFromSnapshot, this);
+  QFutureWatcher<SongList> *watcher = new QFutureWatcher<SongList>();
+  QObject::connect(watcher, &QFutureWatcher<void>::finished, this, &CollectionModel::LoadSongsFromSnapshotAsyncFinished);
+  watcher->setFuture(future);
+
+}
+
+SongList CollectionModel::LoadSongsFromSnapshot() const {
+
+  SongList songs;
+
+  QFile file(SnapshotFilePath());
+  if (!file.exists() || !file.open(QIODevice::ReadOnly)) return songs;
+
+  // Map the snapshot instead of reading it, so deserialization streams straight out of the page cache.
+  uchar *data = file.map(0, file.size());
+  const QByteArray bytes = data ? QByteArray::fromRawData(reinterpret_cast<const char*>(data), static_cast<qsizetype>(file.size())) : file.readAll();
+  QDataStream stream(bytes);
+  stream.setVersion(QDataStream::Qt_6_0);
+
+  quint32 magic = 0;
+  quint32 format_version = 0;
+  qint32 schema_version = 0;
+  qint32 columns = 0;
+  qint32 count = 0;
+  stream >> magic >> format_version >> schema_version >> columns >> count;
+  if (magic != kSnapshotMagic || format_version != kSnapshotFormatVersion || schema_version != Database::kSchemaVersion || columns != Song::kRowIdColumns.count() || count < 0) {
+    return songs;
+  }
+
+  QSqlRecord record;
+  for (const QString &column : Song::kRowIdColumns) {
+    record.append(QSqlField(column));
+  }
+
+  songs.reserve(count);
+  for (qint32 i = 0; i < count; ++i) {
+    for (qint32 column = 0; column < columns; ++column) {
+      QVariant value;
+      stream >> value;
+      record.setValue(column, value);
+    }
+    if (stream.status() != QDataStream::Ok) {
+      return SongList();
+    }
+    Song song(backend_->source());
+    song.InitFromQuery(record, true);
+    songs << song;
+  }
+
   return songs;
 
 }
 
-void CollectionModel::LoadSongsFromSqlAsyncFinished() {
+void CollectionModel::LoadSongsFromSnapshotAsyncFinished() {
 
   QFutureWatcher<SongList> *watcher = static_cast<QFutureWatcher<SongList>*>(sender());
   const SongList songs = watcher->result();
   watcher->deleteLater();
 
+  // The SQL load is authoritative, once its chunks started arriving the snapshot is obsolete.
+  if (sql_chunks_started_ || songs.isEmpty()) return;
+
   BeginReset();
-  ScheduleAddSongs(songs);
   EndReset();
-
+  // Let the update queue apply the snapshot songs right away.
   loading_ = false;
+  ScheduleAddSongs(songs);
 
-  if (!updates_.isEmpty() && !timer_update_->isActive()) {
-    timer_update_->start();
+}
+
+void CollectionModel::SaveSnapshotAsync() {
+
+  (void)QtConcurrent::run(&CollectionModel::SaveSnapshot, this);
+
+}
+
+void CollectionModel::SaveSnapshot() const {
+
+  QSaveFile file(SnapshotFilePath());
+  if (!file.open(QIODevice::WriteOnly)) return;
+
+  QDataStream stream(&file);
+  stream.setVersion(QDataStream::Qt_6_0);
+  stream << kSnapshotMagic << kSnapshotFormatVersion << static_cast<qint32>(Database::kSchemaVersion) << static_cast<qint32>(Song::kRowIdColumns.count());
+
+  {
+    QMutexLocker l(backend_->db()->Mutex());
+    QSqlDatabase db(backend_->db()->Connect());
+    CollectionQuery q(db, backend_->songs_table(), CollectionFilterOptions());
+    q.SetColumnSpec(u"%songs_table.ROWID, "_s + Song::kColumnSpec);
+    if (!q.Exec()) {
+      backend_->ReportErrors(q);
+      return;
+    }
+    // The row count isn't known up front, backpatch it after streaming the rows.
+    const qint64 count_pos = file.pos();
+    qint32 count = 0;
+    stream << count;
+    const int columns = static_cast<int>(Song::kRowIdColumns.count());
+    while (q.Next()) {
+      const QSqlRecord record = q.record();
+      for (int column = 0; column < columns; ++column) {
+        stream << record.value(column);
+      }
+      ++count;
+    }
+    file.seek(count_pos);
+    stream << count;
   }
 
+  if (QThread::currentThread() != thread() && QThread::currentThread() != backend_->thread()) {
+    backend_->db()->Close();
+  }
+
+  file.commit();
+
 }
 
 QString CollectionModel::AlbumIconPixmapCacheKey(const QModelIndex &idx) const {
@@ -906,9 +1104,11 @@ QVariant CollectionModel::AlbumIcon(const QModelIndex &idx) {
     ScopedPtr<QIODevice> disk_cache_img(icon_disk_cache_->data(AlbumIconPixmapDiskCacheKey(cache_key)));
     if (disk_cache_img) {
       QImage cached_image;
-      if (cached_image.load(&*disk_cache_img, "XPM")) {
-        QPixmapCache::insert(cache_key, QPixmap::fromImage(cached_image));
-        return QPixmap::fromImage(cached_image);
+      // Icons were historically stored as XPM, keep reading those entries.
+      if (cached_image.load(&*disk_cache_img, "PNG") || (disk_cache_img->reset() && cached_image.load(&*disk_cache_img, "XPM"))) {
+        const QPixmap cached_pixmap_from_disk = QPixmap::fromImage(cached_image);
+        QPixmapCache::insert(cache_key, cached_pixmap_from_disk);
+        return cached_pixmap_from_disk;
       }
     }
   }
@@ -918,6 +1118,11 @@ QVariant CollectionModel::AlbumIcon(const QModelIndex &idx) {
     return pixmap_no_cover_;
   }
 
+  // Don't queue cover loads for rows flying past during a fast scroll, the view repaints once it settles.
+  if (fast_scrolling_) {
+    return pixmap_no_cover_;
+  }
+
   // No art is cached and we're not loading it already.  Load art for the first song in the album.
   SongList songs = GetChildSongs(idx);
   if (!songs.isEmpty()) {
@@ -968,7 +1173,7 @@ void CollectionModel::AlbumCoverLoaded(const quint64 id, const AlbumCoverLoaderR
       disk_cache_metadata.setRawHeaders(QNetworkCacheMetaData::RawHeaderList() << qMakePair(QByteArray("collection-thumbnail"), cache_key.toUtf8()));
       QIODevice *device_iconcache = icon_disk_cache_->prepare(disk_cache_metadata);
       if (device_iconcache) {
-        result.image_scaled.save(device_iconcache, "XPM");
+        result.image_scaled.save(device_iconcache, "PNG");
         icon_disk_cache_->insert(device_iconcache);
       }
     }
@@ -1156,6 +1361,18 @@ QString CollectionModel::SortText(QString text) {
 
 QString CollectionModel::SortTextForArtist(QString artist, const bool skip_articles) {
 
+  // The unicode regex in SortText runs for every song at every group level, and artist and album
+  // strings repeat across most of the collection, so memoize the derived sort keys.
+  // These depend on the articles setting, which is why they are cached here and not in the database.
+  static QHash<QString, QString> cache_with_articles;
+  static QHash<QString, QString> cache_skip_articles;
+  QHash<QString, QString> &cache = skip_articles ? cache_skip_articles : cache_with_articles;
+  const QString key = artist;
+  const QHash<QString, QString>::const_iterator it = cache.constFind(key);
+  if (it != cache.constEnd()) {
+    return *it;
+  }
+
   artist = SortText(artist);
 
   if (skip_articles) {
@@ -1168,6 +1385,9 @@ QString CollectionModel::SortTextForArtist(QString artist, const bool skip_artic
     }
   }
 
+  if (cache.count() > 20000) cache.clear();
+  cache.insert(key, artist);
+
   return artist;
 
 }
@@ -27,6 +27,7 @@
 #include <QtGlobal>
 #include <QObject>
 #include <QAbstractItemModel>
+#include <QAtomicInteger>
 #include <QFuture>
 #include <QDataStream>
 #include <QMetaType>
@@ -34,6 +35,7 @@
 #include <QSet>
 #include <QList>
 #include <QMap>
+#include <QHash>
 #include <QVariant>
 #include <QString>
 #include <QStringList>
@@ -145,6 +147,7 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   CollectionFilter *filter() const { return filter_; }
 
   void Init();
+  void set_fast_scrolling(const bool fast_scrolling) { fast_scrolling_ = fast_scrolling; }
   void Reset();
 
   void ReloadSettings();
@@ -165,7 +168,7 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   }
   static bool IsAlbumGroupBy(const GroupBy group_by) { return group_by == GroupBy::Album || group_by == GroupBy::YearAlbum || group_by == GroupBy::AlbumDisc || group_by == GroupBy::YearAlbumDisc || group_by == GroupBy::OriginalYearAlbum || group_by == GroupBy::OriginalYearAlbumDisc; }
 
-  QMap<QString, CollectionItem*> container_nodes(const int i) { return container_nodes_[i]; }
+  QHash<QString, CollectionItem*> container_nodes(const int i) { return container_nodes_[i]; }
   QList<CollectionItem*> song_nodes() const { return song_nodes_.values(); }
   int divider_nodes_count() const { return divider_nodes_.count(); }
 
@@ -243,7 +246,16 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   CollectionItem *CreateCompilationArtistNode(CollectionItem *parent);
 
   void LoadSongsFromSqlAsync();
-  SongList LoadSongsFromSql(const CollectionFilterOptions &filter_options = CollectionFilterOptions());
+  void LoadSongsFromSql(const CollectionFilterOptions &filter_options, const quint64 load_generation);
+  void AddLoadedSongsChunk(const SongList &songs, const quint64 load_generation, const bool first_chunk);
+  void LoadSongsFromSqlFinished(const quint64 load_generation);
+
+  // A binary snapshot of the last full collection load, memory-mapped back in on startup so the model can be populated before the SQL load finishes.
+  QString SnapshotFilePath() const;
+  void LoadSongsFromSnapshotAsync();
+  SongList LoadSongsFromSnapshot() const;
+  void SaveSnapshotAsync();
+  void SaveSnapshot() const;
 
   static QString DividerKey(const GroupBy group_by, const Song &song, const QString &sort_text);
   static QString DividerDisplayText(const GroupBy group_by, const QString &key);
@@ -260,7 +272,7 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   void Reload();
   void ScheduleReset();
   void ProcessUpdate();
-  void LoadSongsFromSqlAsyncFinished();
+  void LoadSongsFromSnapshotAsyncFinished();
   void AlbumCoverLoaded(const quint64 id, const AlbumCoverLoaderResult &result);
 
   // From CollectionBackend
@@ -286,6 +298,8 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   Options options_active_;
 
   bool use_disk_cache_;
+  // While the view reports fast scrolling, no new cover loads are started; rows repaint when it settles.
+  bool fast_scrolling_;
   AlbumCoverLoaderOptions::Types cover_types_;
 
   int total_song_count_;
@@ -293,17 +307,23 @@ class CollectionModel : public SimpleTreeModel<CollectionItem> {
   int total_album_count_;
 
   bool loading_;
+  bool snapshot_load_attempted_;
+  // True once the authoritative SQL load has started replacing the model contents for the current reload.
+  bool sql_chunks_started_;
+  // Incremented per reload; an in-flight load notices it's stale, stops constructing songs and its result is discarded.
+  QAtomicInteger<quint64> load_generation_;
 
   QQueue<CollectionModelUpdate> updates_;
 
   // Keyed on database ID
-  QMap<int, CollectionItem*> song_nodes_;
+  QHash<int, CollectionItem*> song_nodes_;
 
   // Keyed on whatever the key is for that level - artist, album, year, etc.
-  QMap<QString, CollectionItem*> container_nodes_[3];
+  // Keyed column-style indexes over the tree, hot during model builds, hence hashes rather than ordered maps.
+  QHash<QString, CollectionItem*> container_nodes_[3];
 
   // Keyed on a letter, a year, a century, etc.
-  QMap<QString, CollectionItem*> divider_nodes_;
+  QHash<QString, CollectionItem*> divider_nodes_;
 
   using ItemAndCacheKey = QPair<CollectionItem*, QString>;
   QMap<quint64, ItemAndCacheKey> pending_art_;
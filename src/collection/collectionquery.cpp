@@ -99,8 +99,9 @@ void CollectionQuery::AddCompilationRequirement(const bool compilation) {
 }
 
 QString CollectionQuery::GetInnerQuery() const {
+  // Join the view directly; wrapping it in a subselect stopped SQLite from flattening it into the outer query.
   return duplicates_only_
-             ? QStringLiteral(" INNER JOIN (select * from duplicated_songs) dsongs        "
+             ? QStringLiteral(" INNER JOIN duplicated_songs dsongs        "
                    "ON (%songs_table.artist = dsongs.dup_artist       "
                    "AND %songs_table.album = dsongs.dup_album     "
                    "AND %songs_table.title = dsongs.dup_title)    ")
@@ -38,6 +38,8 @@
 #include <QUrl>
 #include <QPixmap>
 #include <QPainter>
+#include <QScrollBar>
+#include <QTimer>
 #include <QRect>
 #include <QFont>
 #include <QFontMetrics>
@@ -106,7 +108,21 @@ CollectionView::CollectionView(QWidget *parent)
       action_no_show_in_various_(nullptr),
       action_delete_files_(nullptr),
       is_in_keyboard_search_(false),
-      delete_files_(false) {
+      delete_files_(false),
+      pending_scroll_value_(-1),
+      timer_restore_settle_(new QTimer(this)),
+      timer_fast_scroll_(new QTimer(this)),
+      last_scroll_value_(0) {
+
+  timer_restore_settle_->setSingleShot(true);
+  timer_restore_settle_->setInterval(1000);
+  QObject::connect(timer_restore_settle_, &QTimer::timeout, this, &CollectionView::RestoreSettled);
+
+  timer_fast_scroll_->setSingleShot(true);
+  timer_fast_scroll_->setInterval(150);
+  QObject::connect(timer_fast_scroll_, &QTimer::timeout, this, &CollectionView::FastScrollSettled);
+  QObject::connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &CollectionView::ScrollBarValueChanged);
+
 
   setObjectName(QLatin1String(metaObject()->className()));
 
@@ -122,7 +138,116 @@ CollectionView::CollectionView(QWidget *parent)
 
 }
 
-CollectionView::~CollectionView() = default;
+CollectionView::~CollectionView() {
+
+  SaveExpandedState();
+
+}
+
+void CollectionView::ScrollBarValueChanged(const int value) {
+
+  // A jump of more than a page between scroll events means the rows are flying past;
+  // pause cover loading until the position settles so the loader only works on rows that stay visible.
+  if (model_ && qAbs(value - last_scroll_value_) > verticalScrollBar()->pageStep()) {
+    model_->set_fast_scrolling(true);
+    timer_fast_scroll_->start();
+  }
+  last_scroll_value_ = value;
+
+}
+
+void CollectionView::FastScrollSettled() {
+
+  if (!model_) return;
+  model_->set_fast_scrolling(false);
+  viewport()->update();
+
+}
+
+void CollectionView::SaveExpandedState() {
+
+  if (!model()) return;
+
+  // Collect the container keys of expanded top-level rows and their expanded children (two levels is what the eye restores).
+  QStringList expanded_keys;
+  const int row_count = model()->rowCount();
+  for (int row = 0; row < row_count && expanded_keys.count() < 500; ++row) {
+    const QModelIndex idx = model()->index(row, 0);
+    if (!isExpanded(idx)) continue;
+    expanded_keys << idx.data(CollectionModel::Role_ContainerKey).toString();
+    const int child_count = model()->rowCount(idx);
+    for (int child_row = 0; child_row < child_count && expanded_keys.count() < 500; ++child_row) {
+      const QModelIndex child_index = model()->index(child_row, 0, idx);
+      if (isExpanded(child_index)) {
+        expanded_keys << child_index.data(CollectionModel::Role_ContainerKey).toString();
+      }
+    }
+  }
+
+  Settings settings;
+  settings.beginGroup(CollectionSettings::kSettingsGroup);
+  settings.setValue("expanded_containers", expanded_keys);
+  settings.setValue("view_scroll_position", verticalScrollBar()->value());
+  settings.endGroup();
+
+}
+
+void CollectionView::RestoreExpandedState() {
+
+  Settings settings;
+  settings.beginGroup(CollectionSettings::kSettingsGroup);
+  const QStringList expanded_keys = settings.value("expanded_containers").toStringList();
+  pending_scroll_value_ = settings.value("view_scroll_position", -1).toInt();
+  settings.endGroup();
+
+  pending_expand_keys_ = QSet<QString>(expanded_keys.begin(), expanded_keys.end());
+  if (pending_expand_keys_.isEmpty() && pending_scroll_value_ == -1) return;
+
+  if (model()) {
+    QObject::connect(model(), &QAbstractItemModel::rowsInserted, this, &CollectionView::RestoreExpandedRows, Qt::UniqueConnection);
+  }
+
+}
+
+void CollectionView::RestoreExpandedRows(const QModelIndex &parent, const int first, const int last) {
+
+  if (pending_expand_keys_.isEmpty() && pending_scroll_value_ == -1) {
+    // Everything restored, this hook has no further work.
+    QObject::disconnect(model(), &QAbstractItemModel::rowsInserted, this, &CollectionView::RestoreExpandedRows);
+    timer_restore_settle_->stop();
+    return;
+  }
+
+  for (int row = first; row <= last; ++row) {
+    const QModelIndex idx = model()->index(row, 0, parent);
+    const QString container_key = idx.data(CollectionModel::Role_ContainerKey).toString();
+    if (pending_expand_keys_.remove(container_key)) {
+      setExpanded(idx, true);
+    }
+  }
+
+  if (pending_scroll_value_ != -1) {
+    verticalScrollBar()->setValue(pending_scroll_value_);
+    if (verticalScrollBar()->value() == pending_scroll_value_) {
+      pending_scroll_value_ = -1;
+    }
+  }
+
+  // Restoration only applies to the initial load; once insertions stop for a moment, give up on what's left
+  // so songs added later (for example by a scan) don't keep yanking the viewport.
+  timer_restore_settle_->start();
+
+}
+
+void CollectionView::RestoreSettled() {
+
+  pending_expand_keys_.clear();
+  pending_scroll_value_ = -1;
+  if (model()) {
+    QObject::disconnect(model(), &QAbstractItemModel::rowsInserted, this, &CollectionView::RestoreExpandedRows);
+  }
+
+}
 
 void CollectionView::Init(const SharedPtr<TaskManager> task_manager,
                           const SharedPtr<TagReaderClient> tagreader_client,
@@ -151,6 +276,9 @@ void CollectionView::Init(const SharedPtr<TaskManager> task_manager,
 
   ReloadSettings();
 
+
+  // Deferred so the model is attached by the container before we hook its row insertions.
+  QTimer::singleShot(0, this, &CollectionView::RestoreExpandedState);
 }
 
 void CollectionView::SaveFocus() {
@@ -341,6 +469,8 @@ void CollectionView::TotalAlbumCountUpdated(const int count) {
 
 void CollectionView::paintEvent(QPaintEvent *event) {
 
+  frame_time_tracer_.FrameStart();
+
   if (total_song_count_ == 0) {
     QPainter p(viewport());
     QRect rect(viewport()->rect());
@@ -369,6 +499,8 @@ void CollectionView::paintEvent(QPaintEvent *event) {
     QTreeView::paintEvent(event);
   }
 
+  frame_time_tracer_.FrameFinished(viewport(), "CollectionView");
+
 }
 
 void CollectionView::mouseReleaseEvent(QMouseEvent *e) {
@@ -34,9 +34,11 @@
 #include "includes/shared_ptr.h"
 #include "core/song.h"
 #include "widgets/autoexpandingtreeview.h"
+#include "utilities/frametimetracer.h"
 
 class QSortFilterProxyModel;
 class QMenu;
+class QTimer;
 class QAction;
 class QContextMenuEvent;
 class QMouseEvent;
@@ -67,6 +69,10 @@ class CollectionView : public AutoExpandingTreeView {
   explicit CollectionView(QWidget *parent = nullptr);
   ~CollectionView() override;
 
+  // Persisted expansion and scroll restoration across sessions.
+  void SaveExpandedState();
+  void RestoreExpandedState();
+
   // Returns Songs currently selected in the collection view.
   // Please note that the selection is recursive meaning that if for example an album is selected this will return all of it's songs.
   SongList GetSelectedSongs() const;
@@ -121,6 +127,10 @@ class CollectionView : public AutoExpandingTreeView {
   void contextMenuEvent(QContextMenuEvent *e) override;
 
  private Q_SLOTS:
+  void RestoreExpandedRows(const QModelIndex &parent, const int first, const int last);
+  void RestoreSettled();
+  void ScrollBarValueChanged(const int value);
+  void FastScrollSettled();
   void Load();
   void AddToPlaylist();
   void AddToPlaylistEnqueue();
@@ -165,6 +175,13 @@ class CollectionView : public AutoExpandingTreeView {
   int total_album_count_;
 
   QPixmap nomusic_;
+  // Container keys saved from the last session that still wait for their rows to appear.
+  QSet<QString> pending_expand_keys_;
+  int pending_scroll_value_;
+  QTimer *timer_restore_settle_;
+  QTimer *timer_fast_scroll_;
+  int last_scroll_value_;
+  mutable FrameTimeTracer frame_time_tracer_;
 
   QMenu *context_menu_;
   QModelIndex context_menu_index_;
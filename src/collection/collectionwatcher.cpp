@@ -26,6 +26,10 @@
 
 #include <QObject>
 #include <QThread>
+#include <QThreadPool>
+#include <QFutureSynchronizer>
+#include <QtConcurrentRun>
+#include <QtConcurrentMap>
 #include <QIODevice>
 #include <QDir>
 #include <QDirIterator>
@@ -42,12 +46,15 @@
 #include <QStringList>
 #include <QUrl>
 #include <QImage>
+#include <QCryptographicHash>
 #include <QMutexLocker>
+#include <QSemaphore>
 #include <QSettings>
 
 #include "core/filesystemwatcherinterface.h"
 #include "core/logging.h"
 #include "core/taskmanager.h"
+#include "core/trace.h"
 #include "core/settings.h"
 #include "utilities/imageutils.h"
 #include "constants/timeconstants.h"
@@ -89,6 +96,7 @@ CollectionWatcher::CollectionWatcher(const Song::Source source,
       original_thread_(nullptr),
       scan_on_startup_(true),
       monitor_(true),
+      scan_threads_(1),
       song_tracking_(false),
       song_ebur128_loudness_analysis_(false),
       mark_songs_unavailable_(source_ == Song::Source::Collection),
@@ -210,6 +218,8 @@ void CollectionWatcher::ReloadSettings() {
     scan_on_startup_ = true;
     monitor_ = true;
   }
+  // 1 keeps the old serialized scan, 0 uses one scan thread per core, anything else is an explicit thread count.
+  scan_threads_ = s.value(CollectionSettings::kScanThreads, 1).toInt();
   const QStringList filters = s.value(CollectionSettings::kCoverArtPatterns, QStringList() << u"front"_s << u"cover"_s).toStringList();
   if (source_ == Song::Source::Collection) {
     song_tracking_ = s.value(CollectionSettings::kSongTracking, false).toBool();
@@ -279,7 +289,7 @@ CollectionWatcher::ScanTransaction::ScanTransaction(CollectionWatcher *watcher,
     description = tr("Updating %1").arg(watcher_->device_name_);
   }
 
-  task_id_ = watcher_->task_manager_->StartTask(description);
+  task_id_ = watcher_->task_manager_->StartTask(description, TaskManager::Priority::Low);
   Q_EMIT watcher_->ScanStarted(task_id_);
 
 }
@@ -297,6 +307,7 @@ CollectionWatcher::ScanTransaction::~ScanTransaction() {
 
 void CollectionWatcher::ScanTransaction::AddToProgress(const quint64 n) {
 
+  QMutexLocker l(&mutex_);
   progress_ += n;
   watcher_->task_manager_->SetTaskProgress(task_id_, progress_, progress_max_);
 
@@ -304,63 +315,184 @@ void CollectionWatcher::ScanTransaction::AddToProgress(const quint64 n) {
 
 void CollectionWatcher::ScanTransaction::AddToProgressMax(const quint64 n) {
 
+  QMutexLocker l(&mutex_);
   progress_max_ += n;
   watcher_->task_manager_->SetTaskProgress(task_id_, progress_, progress_max_);
 
 }
 
+void CollectionWatcher::ScanTransaction::PrewarmCaches() {
+
+  FindSongsInSubdirectory(QString());
+  GetAllSubdirs();
+  if (watcher_->song_tracking_) {
+    HasSongsWithMissingFingerprint(QString());
+  }
+  if (watcher_->song_ebur128_loudness_analysis_) {
+    HasSongsWithMissingLoudnessCharacteristics(QString());
+  }
+
+}
+
+void CollectionWatcher::ScanTransaction::AddNewSong(const Song &song) {
+
+  QMutexLocker l(&mutex_);
+  new_songs_ << song;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddTouchedSong(const Song &song) {
+
+  QMutexLocker l(&mutex_);
+  touched_songs_ << song;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddReaddedSongs(const SongList &songs) {
+
+  QMutexLocker l(&mutex_);
+  readded_songs_ << songs;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddDeletedSong(const Song &song) {
+
+  QMutexLocker l(&mutex_);
+  deleted_songs_ << song;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddDeletedSongIfPathUnchanged(const Song &song, const QString &file) {
+
+  QMutexLocker l(&mutex_);
+  if (files_changed_path_.contains(file)) return;
+  qLog(Debug) << "Song deleted from disk:" << file;
+  deleted_songs_ << song;
+
+}
+
+void CollectionWatcher::ScanTransaction::UndeleteSong(const Song &song) {
+
+  QMutexLocker l(&mutex_);
+  deleted_songs_.removeAll(song);
+
+}
+
+void CollectionWatcher::ScanTransaction::AddNewSubdir(const CollectionSubdirectory &subdir) {
+
+  QMutexLocker l(&mutex_);
+  new_subdirs_ << subdir;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddTouchedSubdir(const CollectionSubdirectory &subdir) {
+
+  QMutexLocker l(&mutex_);
+  touched_subdirs_ << subdir;
+
+}
+
+void CollectionWatcher::ScanTransaction::AddDeletedSubdir(const CollectionSubdirectory &subdir) {
+
+  QMutexLocker l(&mutex_);
+  deleted_subdirs_ << subdir;
+
+}
+
+bool CollectionWatcher::ScanTransaction::HasFileChangedPath(const QString &file) {
+
+  QMutexLocker l(&mutex_);
+  return files_changed_path_.contains(file);
+
+}
+
+void CollectionWatcher::ScanTransaction::AddFileChangedPath(const QString &file) {
+
+  QMutexLocker l(&mutex_);
+  files_changed_path_ << file;
+
+}
+
+void CollectionWatcher::ScanTransaction::CommitSongsIfFull() {
+
+  constexpr qint64 kCommitThreshold = 500;
+
+  // Deletions stay in the transaction: a later subdirectory can still discover that a "deleted" song
+  // merely moved, and flushed deletions couldn't be taken back.
+  SongList new_songs;
+  SongList touched_songs;
+  SongList readded_songs;
+
+  {
+    QMutexLocker l(&mutex_);
+    if (new_songs_.count() + touched_songs_.count() + readded_songs_.count() < kCommitThreshold) return;
+    new_songs = new_songs_;
+    touched_songs = touched_songs_;
+    readded_songs = readded_songs_;
+    new_songs_.clear();
+    touched_songs_.clear();
+    readded_songs_.clear();
+  }
+
+  // The backend lives on its own thread, these queue the writes there while the scan continues.
+  if (!new_songs.isEmpty()) Q_EMIT watcher_->NewOrUpdatedSongs(new_songs);
+  if (!touched_songs.isEmpty()) Q_EMIT watcher_->SongsMTimeUpdated(touched_songs);
+  if (!readded_songs.isEmpty()) Q_EMIT watcher_->SongsReadded(readded_songs);
+
+}
+
 void CollectionWatcher::ScanTransaction::CommitNewOrUpdatedSongs() {
 
-  if (!deleted_songs.isEmpty()) {
+  if (!deleted_songs_.isEmpty()) {
     if (mark_songs_unavailable_ && watcher_->source() == Song::Source::Collection) {
-      Q_EMIT watcher_->SongsUnavailable(deleted_songs);
+      Q_EMIT watcher_->SongsUnavailable(deleted_songs_);
     }
     else {
-      Q_EMIT watcher_->SongsDeleted(deleted_songs);
+      Q_EMIT watcher_->SongsDeleted(deleted_songs_);
     }
-    deleted_songs.clear();
+    deleted_songs_.clear();
   }
 
-  if (!new_songs.isEmpty()) {
-    Q_EMIT watcher_->NewOrUpdatedSongs(new_songs);
-    new_songs.clear();
+  if (!new_songs_.isEmpty()) {
+    Q_EMIT watcher_->NewOrUpdatedSongs(new_songs_);
+    new_songs_.clear();
   }
 
-  if (!touched_songs.isEmpty()) {
-    Q_EMIT watcher_->SongsMTimeUpdated(touched_songs);
-    touched_songs.clear();
+  if (!touched_songs_.isEmpty()) {
+    Q_EMIT watcher_->SongsMTimeUpdated(touched_songs_);
+    touched_songs_.clear();
   }
 
-  if (!readded_songs.isEmpty()) {
-    Q_EMIT watcher_->SongsReadded(readded_songs);
-    readded_songs.clear();
+  if (!readded_songs_.isEmpty()) {
+    Q_EMIT watcher_->SongsReadded(readded_songs_);
+    readded_songs_.clear();
   }
 
-  if (!new_subdirs.isEmpty()) {
-    Q_EMIT watcher_->SubdirsDiscovered(new_subdirs);
+  if (!new_subdirs_.isEmpty()) {
+    Q_EMIT watcher_->SubdirsDiscovered(new_subdirs_);
   }
 
-  if (!touched_subdirs.isEmpty()) {
-    Q_EMIT watcher_->SubdirsMTimeUpdated(touched_subdirs);
-    touched_subdirs.clear();
+  if (!touched_subdirs_.isEmpty()) {
+    Q_EMIT watcher_->SubdirsMTimeUpdated(touched_subdirs_);
+    touched_subdirs_.clear();
   }
 
-  for (const CollectionSubdirectory &subdir : std::as_const(deleted_subdirs)) {
+  for (const CollectionSubdirectory &subdir : std::as_const(deleted_subdirs_)) {
     if (watcher_->watched_dirs_.contains(dir_)) {
       watcher_->RemoveWatch(watcher_->watched_dirs_[dir_], subdir);
     }
   }
-  deleted_subdirs.clear();
+  deleted_subdirs_.clear();
 
   if (watcher_->monitor_) {
     // Watch the new subdirectories
-    for (const CollectionSubdirectory &subdir : std::as_const(new_subdirs)) {
+    for (const CollectionSubdirectory &subdir : std::as_const(new_subdirs_)) {
       if (watcher_->watched_dirs_.contains(dir_)) {
         watcher_->AddWatch(watcher_->watched_dirs_[dir_], subdir.path);
       }
     }
   }
-  new_subdirs.clear();
+  new_subdirs_.clear();
 
   if (incremental_ || ignores_mtime_) {
     Q_EMIT watcher_->UpdateLastSeen(dir_, expire_unavailable_songs_days_);
@@ -371,6 +503,8 @@ void CollectionWatcher::ScanTransaction::CommitNewOrUpdatedSongs() {
 
 SongList CollectionWatcher::ScanTransaction::FindSongsInSubdirectory(const QString &path) {
 
+  QMutexLocker l(&mutex_);
+
   if (cached_songs_dirty_) {
     const SongList songs = watcher_->backend_->FindSongsInDirectory(dir_);
     for (const Song &song : songs) {
@@ -390,6 +524,8 @@ SongList CollectionWatcher::ScanTransaction::FindSongsInSubdirectory(const QStri
 
 bool CollectionWatcher::ScanTransaction::HasSongsWithMissingFingerprint(const QString &path) {
 
+  QMutexLocker l(&mutex_);
+
   if (cached_songs_missing_fingerprint_dirty_) {
     const SongList songs = watcher_->backend_->SongsWithMissingFingerprint(dir_);
     for (const Song &song : songs) {
@@ -405,6 +541,8 @@ bool CollectionWatcher::ScanTransaction::HasSongsWithMissingFingerprint(const QS
 
 bool CollectionWatcher::ScanTransaction::HasSongsWithMissingLoudnessCharacteristics(const QString &path) {
 
+  QMutexLocker l(&mutex_);
+
   if (cached_songs_missing_loudness_characteristics_dirty_) {
     const SongList songs = watcher_->backend_->SongsWithMissingLoudnessCharacteristics(dir_);
     for (const Song &song : songs) {
@@ -418,8 +556,26 @@ bool CollectionWatcher::ScanTransaction::HasSongsWithMissingLoudnessCharacterist
 
 }
 
+SongList CollectionWatcher::ScanTransaction::SongsWithMissingLoudnessCharacteristicsInSubdir(const QString &path) {
+
+  QMutexLocker l(&mutex_);
+
+  if (cached_songs_missing_loudness_characteristics_dirty_) {
+    const SongList songs = watcher_->backend_->SongsWithMissingLoudnessCharacteristics(dir_);
+    for (const Song &song : songs) {
+      const QString p = song.url().toLocalFile().section(u'/', 0, -2);
+      cached_songs_missing_loudness_characteristics_.insert(p, song);
+    }
+    cached_songs_missing_loudness_characteristics_dirty_ = false;
+  }
+
+  return cached_songs_missing_loudness_characteristics_.values(path);
+
+}
+
 void CollectionWatcher::ScanTransaction::SetKnownSubdirs(const CollectionSubdirectoryList &subdirs) {
 
+  QMutexLocker l(&mutex_);
   known_subdirs_ = subdirs;
   known_subdirs_dirty_ = false;
 
@@ -427,8 +583,11 @@ void CollectionWatcher::ScanTransaction::SetKnownSubdirs(const CollectionSubdire
 
 bool CollectionWatcher::ScanTransaction::HasSeenSubdir(const QString &path) {
 
+  QMutexLocker l(&mutex_);
+
   if (known_subdirs_dirty_) {
-    SetKnownSubdirs(watcher_->backend_->SubdirsInDirectory(dir_));
+    known_subdirs_ = watcher_->backend_->SubdirsInDirectory(dir_);
+    known_subdirs_dirty_ = false;
   }
 
   return std::any_of(known_subdirs_.begin(), known_subdirs_.end(), [path](const CollectionSubdirectory &subdir) { return subdir.path == path && subdir.mtime != 0; });
@@ -437,8 +596,11 @@ bool CollectionWatcher::ScanTransaction::HasSeenSubdir(const QString &path) {
 
 CollectionSubdirectoryList CollectionWatcher::ScanTransaction::GetImmediateSubdirs(const QString &path) {
 
+  QMutexLocker l(&mutex_);
+
   if (known_subdirs_dirty_) {
-    SetKnownSubdirs(watcher_->backend_->SubdirsInDirectory(dir_));
+    known_subdirs_ = watcher_->backend_->SubdirsInDirectory(dir_);
+    known_subdirs_dirty_ = false;
   }
 
   CollectionSubdirectoryList ret;
@@ -454,8 +616,11 @@ CollectionSubdirectoryList CollectionWatcher::ScanTransaction::GetImmediateSubdi
 
 CollectionSubdirectoryList CollectionWatcher::ScanTransaction::GetAllSubdirs() {
 
+  QMutexLocker l(&mutex_);
+
   if (known_subdirs_dirty_) {
-    SetKnownSubdirs(watcher_->backend_->SubdirsInDirectory(dir_));
+    known_subdirs_ = watcher_->backend_->SubdirsInDirectory(dir_);
+    known_subdirs_dirty_ = false;
   }
 
   return known_subdirs_;
@@ -490,10 +655,7 @@ void CollectionWatcher::AddDirectory(const CollectionDirectory &dir, const Colle
       const quint64 files_count = FilesCountForSubdirs(&transaction, subdirs, subdir_files_count);
       transaction.SetKnownSubdirs(subdirs);
       transaction.AddToProgressMax(files_count);
-      for (const CollectionSubdirectory &subdir : subdirs) {
-        if (stop_or_abort_requested()) break;
-        ScanSubdirectory(subdir.path, subdir, subdir_files_count[subdir.path], &transaction);
-      }
+      ScanSubdirectories(subdirs, subdir_files_count, &transaction);
       if (!stop_or_abort_requested()) {
         last_scan_time_ = QDateTime::currentSecsSinceEpoch();
       }
@@ -506,6 +668,8 @@ void CollectionWatcher::AddDirectory(const CollectionDirectory &dir, const Colle
 
 void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSubdirectory &subdir, const quint64 files_count, ScanTransaction *t, const bool force_noincremental) {
 
+  Tracing::ScopedTrace trace("CollectionWatcher::ScanSubdirectory");
+
   QFileInfo path_info(path);
 
   // Do not scan symlinked dirs that are already in collection
@@ -537,6 +701,38 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
     return;
   }
 
+  // When the directory itself is unchanged and only loudness characteristics are missing,
+  // analyze just those songs as one batch instead of walking every file in the directory again.
+  if (!t->ignores_mtime() && !force_noincremental && t->is_incremental() && subdir.mtime == path_info.lastModified().toSecsSinceEpoch() && !songs_missing_fingerprint && songs_missing_loudness_characteristics) {
+    SongList songs_to_analyze = t->SongsWithMissingLoudnessCharacteristicsInSubdir(path);
+    QtConcurrent::blockingMap(songs_to_analyze, [this](Song &song) {
+      if (stop_or_abort_requested()) return;
+      PerformEBUR128Analysis(song);
+    });
+    for (const Song &song : std::as_const(songs_to_analyze)) {
+      if (song.ebur128_integrated_loudness_lufs() || song.ebur128_loudness_range_lu()) {
+        t->AddNewSong(song);
+      }
+    }
+    t->AddToProgress(files_count);
+    return;
+  }
+
+  // Even when the mtime has changed the actual contents may not have, which is common on network filesystems where directory mtimes are unreliable.
+  // Compare a fingerprint of the directory listing against the one persisted from the last scan, and skip the subdirectory when it still matches.
+  QString listing_fingerprint;
+  if (!t->ignores_mtime() && !force_noincremental && t->is_incremental() && path_info.exists() && !subdir.fingerprint.isEmpty() && !songs_missing_fingerprint && !songs_missing_loudness_characteristics) {
+    listing_fingerprint = ListingFingerprint(path);
+    if (subdir.fingerprint == listing_fingerprint) {
+      CollectionSubdirectory touched_subdir = subdir;
+      touched_subdir.directory_id = t->dir();
+      touched_subdir.mtime = path_info.lastModified().toSecsSinceEpoch();
+      t->AddTouchedSubdir(touched_subdir);
+      t->AddToProgress(files_count);
+      return;
+    }
+  }
+
   QMap<QString, QStringList> album_art;
   QStringList files_on_disk;
   CollectionSubdirectoryList my_new_subdirs;
@@ -580,7 +776,8 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
         album_art[dir_part] << child;
         t->AddToProgress(1);
       }
-      else if (tagreader_client_->IsMediaFileBlocking(child)) {
+      else if (Song::kAcceptedExtensions.contains(child_info.suffix(), Qt::CaseInsensitive) || tagreader_client_->IsMediaFileBlocking(child)) {
+        // Known extensions answer the capability question directly; only unknown suffixes need a typefind probe.
         files_on_disk << child;
       }
       else {
@@ -594,6 +791,9 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
   // Ask the database for a list of files in this directory
   SongList songs_in_db = t->FindSongsInSubdirectory(path);
 
+  // New songs found in this subdirectory, loudness-analyzed as one parallel batch below.
+  SongList new_songs_in_subdir;
+
   QSet<QString> cues_processed;
 
   // Now compare the list from the database with the list of files on disk
@@ -672,11 +872,7 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
         QString fingerprint;
 #ifdef HAVE_SONGFINGERPRINTING
         if (song_tracking_) {
-          Chromaprinter chromaprinter(file);
-          fingerprint = chromaprinter.CreateFingerprint();
-          if (fingerprint.isEmpty()) {
-            fingerprint = "NONE"_L1;
-          }
+          fingerprint = CreateSongFingerprint(file);
         }
 #endif
 
@@ -691,7 +887,7 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
       // Nothing has changed - mark the song available without re-scanning
       else if (matching_song.unavailable()) {
         qLog(Debug) << "Unavailable song" << file << "restored.";
-        t->readded_songs << matching_songs;
+        t->AddReaddedSongs(matching_songs);
       }
 
     }
@@ -699,11 +895,7 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
       QString fingerprint;
 #ifdef HAVE_SONGFINGERPRINTING
       if (song_tracking_) {
-        Chromaprinter chromaprinter(file);
-        fingerprint = chromaprinter.CreateFingerprint();
-        if (fingerprint.isEmpty()) {
-          fingerprint = "NONE"_L1;
-        }
+        fingerprint = CreateSongFingerprint(file);
       }
 #endif
       if (song_tracking_ && !fingerprint.isEmpty() && fingerprint != "NONE"_L1 && FindSongsByFingerprint(file, fingerprint, &matching_songs)) {
@@ -722,13 +914,11 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
         bool matching_songs_has_cue = false;
         for (const Song &matching_song : std::as_const(matching_songs)) {
           QString matching_filename = matching_song.url().toLocalFile();
-          if (!t->files_changed_path_.contains(matching_filename)) {
-            t->files_changed_path_ << matching_filename;
+          if (!t->HasFileChangedPath(matching_filename)) {
+            t->AddFileChangedPath(matching_filename);
             qLog(Debug) << matching_filename << "has changed path to" << file;
           }
-          if (t->deleted_songs.contains(matching_song)) {
-            t->deleted_songs.removeAll(matching_song);
-          }
+          t->UndeleteSong(matching_song);
           if (matching_song.has_cue()) {
             matching_songs_has_cue = true;
           }
@@ -767,19 +957,31 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
         for (Song song : songs) {
           song.set_directory_id(t->dir());
           if (song.art_automatic().isEmpty()) song.set_art_automatic(art_automatic);
-          t->new_songs << song;
+          new_songs_in_subdir << song;
         }
       }
     }
     t->AddToProgress(1);
   }
 
-  // Look for deleted songs
+  // Analyze loudness for the new songs of this subdirectory in one parallel batch instead of per file while scanning.
+  if (song_ebur128_loudness_analysis_ && !new_songs_in_subdir.isEmpty()) {
+    QtConcurrent::blockingMap(new_songs_in_subdir, [this](Song &song) {
+      if (stop_or_abort_requested()) return;
+      PerformEBUR128Analysis(song);
+    });
+  }
+  for (const Song &song : std::as_const(new_songs_in_subdir)) {
+    t->AddNewSong(song);
+  }
+
+  // Look for deleted songs. Membership over the listing is checked against a set,
+  // the list-scan per database song made big directories quadratic.
+  const QSet<QString> files_on_disk_set(files_on_disk.begin(), files_on_disk.end());
   for (const Song &song : std::as_const(songs_in_db)) {
     QString file = song.url().toLocalFile();
-    if (!song.unavailable() && !files_on_disk.contains(file) && !t->files_changed_path_.contains(file)) {
-      qLog(Debug) << "Song deleted from disk:" << file;
-      t->deleted_songs << song;
+    if (!song.unavailable() && !files_on_disk_set.contains(file)) {
+      t->AddDeletedSongIfPathUnchanged(song, file);
     }
   }
 
@@ -788,18 +990,24 @@ void CollectionWatcher::ScanSubdirectory(const QString &path, const CollectionSu
   updated_subdir.directory_id = t->dir();
   updated_subdir.mtime = path_info.exists() ? path_info.lastModified().toSecsSinceEpoch() : 0;
   updated_subdir.path = path;
+  if (path_info.exists()) {
+    updated_subdir.fingerprint = listing_fingerprint.isEmpty() ? ListingFingerprint(path) : listing_fingerprint;
+  }
 
   if (subdir.directory_id == -1) {
-    t->new_subdirs << updated_subdir;
+    t->AddNewSubdir(updated_subdir);
   }
   else {
-    t->touched_subdirs << updated_subdir;
+    t->AddTouchedSubdir(updated_subdir);
   }
 
   if (updated_subdir.mtime == 0) {  // CollectionSubdirectory deleted, mark it for removal from the watcher.
-    t->deleted_subdirs << updated_subdir;
+    t->AddDeletedSubdir(updated_subdir);
   }
 
+  // Flush accumulated song results so the backend writes while the scan continues.
+  t->CommitSongsIfFull();
+
   // Recurse into the new subdirs that we found
   for (const CollectionSubdirectory &my_new_subdir : std::as_const(my_new_subdirs)) {
     if (stop_or_abort_requested()) return;
@@ -822,14 +1030,9 @@ void CollectionWatcher::UpdateCueAssociatedSongs(const QString &file,
   }
 
   // Load new CUE songs
-  QFile cue_file(matching_cue);
-  if (!cue_file.exists()) return;
-  if (!cue_file.open(QIODevice::ReadOnly)) {
-    qLog(Error) << "Could not open CUE file" << matching_cue << "for reading:" << cue_file.errorString();
-    return;
-  }
-  const SongList songs = cue_parser_->Load(&cue_file, matching_cue, path, false);
-  cue_file.close();
+  const std::optional<SongList> cue_songs = LoadCueSongs(matching_cue, path);
+  if (!cue_songs) return;
+  const SongList songs = *cue_songs;
 
   // Update every song that's in the CUE and collection
   QSet<int> used_ids;
@@ -848,14 +1051,14 @@ void CollectionWatcher::UpdateCueAssociatedSongs(const QString &file,
       used_ids.insert(matching_cue_song.id());
     }
     else {  // A new section
-      t->new_songs << new_cue_song;
+      t->AddNewSong(new_cue_song);
     }
   }
 
   // Sections that are now missing
   for (const Song &old_cue : old_cue_songs) {
     if (!used_ids.contains(old_cue.id())) {
-      t->deleted_songs << old_cue;
+      t->AddDeletedSong(old_cue);
     }
   }
 
@@ -873,14 +1076,24 @@ void CollectionWatcher::UpdateNonCueAssociatedSong(const QString &file,
   if (cue_deleted) {
     for (const Song &song : matching_songs) {
       if (!song.IsAllMetadataEqual(matching_song)) {
-        t->deleted_songs << song;
+        t->AddDeletedSong(song);
       }
     }
   }
 
+  // A changed file with an identical size is almost always an in-place tag edit,
+  // so re-read only the tags and keep the known audio properties.
+  const bool partial = matching_song.filesize() > 0 && matching_song.filesize() == QFileInfo(file).size();
+
   Song song_on_disk(source_);
-  const TagReaderResult result = tagreader_client_->ReadFileBlocking(file, &song_on_disk);
+  const TagReaderResult result = tagreader_client_->ReadFileBlocking(file, &song_on_disk, partial);
   if (result.success() && song_on_disk.is_valid()) {
+    if (partial) {
+      song_on_disk.set_length_nanosec(matching_song.length_nanosec());
+      song_on_disk.set_bitrate(matching_song.bitrate());
+      song_on_disk.set_samplerate(matching_song.samplerate());
+      song_on_disk.set_bitdepth(matching_song.bitdepth());
+    }
     song_on_disk.set_source(source_);
     song_on_disk.set_directory_id(t->dir());
     song_on_disk.set_id(matching_song.id());
@@ -903,24 +1116,17 @@ SongList CollectionWatcher::ScanNewFile(const QString &file, const QString &path
     // Don't process the same CUE many times
     if (cues_processed->contains(matching_cue)) return songs;
 
-    QFile cue_file(matching_cue);
-    if (!cue_file.exists()) return songs;
-
-    if (!cue_file.open(QIODevice::ReadOnly)) {
-      qLog(Error) << "Could not open CUE file" << matching_cue << "for reading:" << cue_file.errorString();
-      return songs;
-    }
+    const std::optional<SongList> loaded_cue_songs = LoadCueSongs(matching_cue, path);
+    if (!loaded_cue_songs) return songs;
 
     // Ignore FILEs pointing to other media files.
     // Also, watch out for incorrect media files.
     // Playlist parser for CUEs considers every entry in sheet valid, and we don't want invalid media getting into collection!
     QString file_nfd = file.normalized(QString::NormalizationForm_D);
-    SongList cue_songs = cue_parser_->Load(&cue_file, matching_cue, path, false);
-    cue_file.close();
+    SongList cue_songs = *loaded_cue_songs;
     songs.reserve(cue_songs.count());
     for (Song &cue_song : cue_songs) {
       cue_song.set_source(source_);
-      PerformEBUR128Analysis(cue_song);
       cue_song.set_fingerprint(fingerprint);
       if (cue_song.url().toLocalFile().normalized(QString::NormalizationForm_D) == file_nfd) {
         songs << cue_song;
@@ -935,7 +1141,6 @@ SongList CollectionWatcher::ScanNewFile(const QString &file, const QString &path
     const TagReaderResult result = tagreader_client_->ReadFileBlocking(file, &song);
     if (result.success() && song.is_valid()) {
       song.set_source(source_);
-      PerformEBUR128Analysis(song);
       song.set_fingerprint(fingerprint);
       songs << song;
     }
@@ -1005,10 +1210,10 @@ void CollectionWatcher::AddChangedSong(const QString &file, const Song &matching
   }
 
   if (notify_new) {
-    t->new_songs << new_song;
+    t->AddNewSong(new_song);
   }
   else {
-    t->touched_songs << new_song;
+    t->AddTouchedSong(new_song);
   }
 
 }
@@ -1018,6 +1223,11 @@ void CollectionWatcher::PerformEBUR128Analysis(Song &song) const {
   if (!song_ebur128_loudness_analysis_) return;
 
 #ifdef HAVE_EBUR128
+  // Loudness analysis decodes the whole file, keep the number of simultaneous decode pipelines bounded like fingerprinting.
+  static QSemaphore analysis_slots(qBound(1, QThread::idealThreadCount() / 2, 4));
+  analysis_slots.acquire();
+  const QSemaphoreReleaser releaser(analysis_slots);
+
   std::optional<EBUR128Measures> loudness_characteristics = EBUR128Analysis::Compute(song);
   if (loudness_characteristics) {
     song.set_ebur128_integrated_loudness_lufs(loudness_characteristics->loudness_lufs);
@@ -1029,6 +1239,79 @@ void CollectionWatcher::PerformEBUR128Analysis(Song &song) const {
 
 }
 
+QString CollectionWatcher::ListingFingerprint(const QString &path) {
+
+  QStringList entries;
+  QDirIterator it(path, QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot);
+  while (it.hasNext()) {
+    it.next();
+    const QFileInfo fileinfo = it.fileInfo();
+    entries << QStringLiteral("%1|%2|%3").arg(fileinfo.fileName(), QString::number(fileinfo.lastModified().toSecsSinceEpoch()), QString::number(fileinfo.size()));
+  }
+  entries.sort();
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  for (const QString &entry : std::as_const(entries)) {
+    hash.addData(entry.toUtf8());
+  }
+
+  return QString::fromLatin1(hash.result().toHex());
+
+}
+
+std::optional<SongList> CollectionWatcher::LoadCueSongs(const QString &matching_cue, const QString &path) const {
+
+  const qint64 cue_mtime = static_cast<qint64>(GetMtimeForCue(matching_cue));
+  if (cue_mtime == 0) return std::nullopt;
+
+  {
+    QMutexLocker l(&mutex_cue_cache_);
+    if (cue_cache_.contains(matching_cue)) {
+      const CueCacheEntry &entry = cue_cache_[matching_cue];
+      if (entry.mtime == cue_mtime && entry.path == path) {
+        return entry.songs;
+      }
+    }
+  }
+
+  QFile cue_file(matching_cue);
+  if (!cue_file.exists()) return std::nullopt;
+  if (!cue_file.open(QIODevice::ReadOnly)) {
+    qLog(Error) << "Could not open CUE file" << matching_cue << "for reading:" << cue_file.errorString();
+    return std::nullopt;
+  }
+  const SongList songs = cue_parser_->Load(&cue_file, matching_cue, path, false);
+  cue_file.close();
+
+  {
+    QMutexLocker l(&mutex_cue_cache_);
+    cue_cache_.insert(matching_cue, CueCacheEntry{cue_mtime, path, songs});
+  }
+
+  return songs;
+
+}
+
+QString CollectionWatcher::CreateSongFingerprint(const QString &file) {
+
+#ifdef HAVE_SONGFINGERPRINTING
+  // Chromaprinter itself bounds the number of concurrent decode pipelines.
+  Chromaprinter chromaprinter(file);
+  QString fingerprint = chromaprinter.CreateFingerprint();
+
+  if (fingerprint.isEmpty()) {
+    fingerprint = "NONE"_L1;
+  }
+
+  return fingerprint;
+#else
+  Q_UNUSED(file)
+
+  return QString();
+#endif
+
+}
+
 quint64 CollectionWatcher::GetMtimeForCue(const QString &cue_path) {
 
   if (cue_path.isEmpty()) {
@@ -1158,14 +1441,16 @@ void CollectionWatcher::RescanPathsNow() {
       transaction.AddToProgressMax(files_count);
     }
 
+    CollectionSubdirectoryList subdirs;
+    subdirs.reserve(paths.count());
     for (const QString &path : paths) {
-      if (stop_or_abort_requested()) break;
       CollectionSubdirectory subdir;
       subdir.directory_id = dir;
       subdir.mtime = 0;
       subdir.path = path;
-      ScanSubdirectory(path, subdir, subdir_files_count[path], &transaction);
+      subdirs << subdir;
     }
+    ScanSubdirectories(subdirs, subdir_files_count, &transaction);
   }
 
   rescan_queue_.clear();
@@ -1301,10 +1586,7 @@ void CollectionWatcher::PerformScan(const bool incremental, const bool ignore_mt
     quint64 files_count = FilesCountForSubdirs(&transaction, subdirs, subdir_files_count);
     transaction.AddToProgressMax(files_count);
 
-    for (const CollectionSubdirectory &subdir : std::as_const(subdirs)) {
-      if (stop_or_abort_requested()) break;
-      ScanSubdirectory(subdir.path, subdir, subdir_files_count[subdir.path], &transaction);
-    }
+    ScanSubdirectories(subdirs, subdir_files_count, &transaction);
 
   }
 
@@ -1314,6 +1596,36 @@ void CollectionWatcher::PerformScan(const bool incremental, const bool ignore_mt
 
 }
 
+void CollectionWatcher::ScanSubdirectories(const CollectionSubdirectoryList &subdirs, const QMap<QString, quint64> &subdir_files_count, ScanTransaction *t) {
+
+  if (scan_threads_ == 1 || subdirs.count() <= 1) {
+    for (const CollectionSubdirectory &subdir : subdirs) {
+      if (stop_or_abort_requested()) break;
+      ScanSubdirectory(subdir.path, subdir, subdir_files_count.value(subdir.path), t);
+    }
+    return;
+  }
+
+  // Load the transaction caches up front so that the workers don't race to populate them,
+  // then let the pool's work queue distribute subdirectories across the scan threads.
+  t->PrewarmCaches();
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(scan_threads_ > 0 ? scan_threads_ : QThread::idealThreadCount());
+
+  QFutureSynchronizer<void> synchronizer;
+  for (const CollectionSubdirectory &subdir : subdirs) {
+    if (stop_or_abort_requested()) break;
+    const quint64 files_count = subdir_files_count.value(subdir.path);
+    synchronizer.addFuture(QtConcurrent::run(&pool, [this, subdir, files_count, t]() {
+      if (stop_or_abort_requested()) return;
+      ScanSubdirectory(subdir.path, subdir, files_count, t);
+    }));
+  }
+  synchronizer.waitForFinished();
+
+}
+
 quint64 CollectionWatcher::FilesCountForPath(ScanTransaction *t, const QString &path) {
 
   quint64 i = 0;
@@ -35,6 +35,8 @@
 #include <QUrl>
 #include <QMutex>
 
+#include <optional>
+
 #include "collectiondirectory.h"
 #include "includes/shared_ptr.h"
 #include "core/song.h"
@@ -111,6 +113,7 @@ class CollectionWatcher : public QObject {
     SongList FindSongsInSubdirectory(const QString &path);
     bool HasSongsWithMissingFingerprint(const QString &path);
     bool HasSongsWithMissingLoudnessCharacteristics(const QString &path);
+    SongList SongsWithMissingLoudnessCharacteristicsInSubdir(const QString &path);
     bool HasSeenSubdir(const QString &path);
     void SetKnownSubdirs(const CollectionSubdirectoryList &subdirs);
     CollectionSubdirectoryList GetImmediateSubdirs(const QString &path);
@@ -119,26 +122,47 @@ class CollectionWatcher : public QObject {
     void AddToProgress(const quint64 n = 1);
     void AddToProgressMax(const quint64 n);
 
+    // Loads the cached song lists and known subdirs up front so that worker threads only take read access afterwards.
+    void PrewarmCaches();
+
     // Emits the signals for new & deleted songs etc and clears the lists. This causes the new stuff to be updated on UI.
     void CommitNewOrUpdatedSongs();
 
+    // Flushes the accumulated song results to the backend when enough have piled up,
+    // so long scans write incrementally from the scan threads instead of holding everything until the transaction ends.
+    void CommitSongsIfFull();
+
     int dir() const { return dir_; }
     bool is_incremental() const { return incremental_; }
     bool ignores_mtime() const { return ignores_mtime_; }
 
-    SongList deleted_songs;
-    SongList readded_songs;
-    SongList new_songs;
-    SongList touched_songs;
-    CollectionSubdirectoryList new_subdirs;
-    CollectionSubdirectoryList touched_subdirs;
-    CollectionSubdirectoryList deleted_subdirs;
-
-    QStringList files_changed_path_;
+    // These collect the results of ScanSubdirectory() and are safe to call from multiple scan threads at once.
+    void AddNewSong(const Song &song);
+    void AddTouchedSong(const Song &song);
+    void AddReaddedSongs(const SongList &songs);
+    void AddDeletedSong(const Song &song);
+    // Adds the song to the deleted list unless another scan thread has already seen its file change path, in one atomic step.
+    void AddDeletedSongIfPathUnchanged(const Song &song, const QString &file);
+    void UndeleteSong(const Song &song);
+    void AddNewSubdir(const CollectionSubdirectory &subdir);
+    void AddTouchedSubdir(const CollectionSubdirectory &subdir);
+    void AddDeletedSubdir(const CollectionSubdirectory &subdir);
+    bool HasFileChangedPath(const QString &file);
+    void AddFileChangedPath(const QString &file);
 
    private:
     ScanTransaction &operator=(const ScanTransaction&) { return *this; }
 
+    SongList deleted_songs_;
+    SongList readded_songs_;
+    SongList new_songs_;
+    SongList touched_songs_;
+    CollectionSubdirectoryList new_subdirs_;
+    CollectionSubdirectoryList touched_subdirs_;
+    CollectionSubdirectoryList deleted_subdirs_;
+
+    QSet<QString> files_changed_path_;
+
     int task_id_;
     quint64 progress_;
     quint64 progress_max_;
@@ -169,6 +193,9 @@ class CollectionWatcher : public QObject {
 
     CollectionSubdirectoryList known_subdirs_;
     bool known_subdirs_dirty_;
+
+    // Guards the result lists, the progress counters and the lazily loaded caches above when subdirectories are scanned in parallel.
+    mutable QMutex mutex_;
   };
 
  private Q_SLOTS:
@@ -197,7 +224,11 @@ class CollectionWatcher : public QObject {
   void AddWatch(const CollectionDirectory &dir, const QString &path);
   void RemoveWatch(const CollectionDirectory &dir, const CollectionSubdirectory &subdir);
   static quint64 GetMtimeForCue(const QString &cue_path);
+  // Hashes the names, mtimes and sizes of the entries in the given directory, for comparison against CollectionSubdirectory::fingerprint.
+  static QString ListingFingerprint(const QString &path);
   void PerformScan(const bool incremental, const bool ignore_mtimes);
+  // Scans the given subdirectories, fanning them out across a thread pool when more than one scan thread is configured.
+  void ScanSubdirectories(const CollectionSubdirectoryList &subdirs, const QMap<QString, quint64> &subdir_files_count, ScanTransaction *t);
 
   // Updates the sections of a cue associated and altered (according to mtime) media file during a scan.
   void UpdateCueAssociatedSongs(const QString &file, const QString &path, const QString &fingerprint, const QString &matching_cue, const QUrl &art_automatic, const SongList &old_cue_songs, ScanTransaction *t) const;
@@ -216,6 +247,14 @@ class CollectionWatcher : public QObject {
 
   QString FindCueFilename(const QString &filename);
 
+  // Parses the given CUE sheet, serving repeated loads of the same unchanged sheet from a cache keyed by mtime.
+  // Returns std::nullopt when the sheet can't be opened, as opposed to a sheet that parses to no songs.
+  std::optional<SongList> LoadCueSongs(const QString &matching_cue, const QString &path) const;
+
+  // Creates a chromaprint fingerprint for the file, returning "NONE" when fingerprinting fails.
+  // Concurrent computations are bounded by a shared semaphore so parallel scan threads can't spawn an unbounded number of decode pipelines.
+  static QString CreateSongFingerprint(const QString &file);
+
  private:
   const Song::Source source_;
 
@@ -235,6 +274,7 @@ class CollectionWatcher : public QObject {
 
   bool scan_on_startup_;
   bool monitor_;
+  int scan_threads_;
   bool song_tracking_;
   bool song_ebur128_loudness_analysis_;
   bool mark_songs_unavailable_;
@@ -258,6 +298,14 @@ class CollectionWatcher : public QObject {
 
   CueParser *cue_parser_;
 
+  struct CueCacheEntry {
+    qint64 mtime;
+    QString path;
+    SongList songs;
+  };
+  mutable QHash<QString, CueCacheEntry> cue_cache_;
+  mutable QMutex mutex_cue_cache_;
+
   static QStringList sValidImages;
 
   qint64 last_scan_time_;
@@ -40,6 +40,7 @@ constexpr char kStrictSSL[] = "strict_ssl";
 constexpr char kBufferDuration[] = "bufferduration";
 constexpr char kBufferLowWatermark[] = "bufferlowwatermark";
 constexpr char kBufferHighWatermark[] = "bufferhighwatermark";
+constexpr char kBufferAutoTune[] = "buffer_auto_tune";
 constexpr char kRgEnabled[] = "rgenabled";
 constexpr char kRgMode[] = "rgmode";
 constexpr char kRgPreamp[] = "rgpreamp";
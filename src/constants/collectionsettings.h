@@ -31,12 +31,14 @@ constexpr char kVariousArtists[] = "various_artists";
 constexpr char kSortSkipsArticles[] = "sort_skips_articles";
 constexpr char kStartupScan[] = "startup_scan";
 constexpr char kMonitor[] = "monitor";
+constexpr char kScanThreads[] = "scan_threads";
 constexpr char kSongTracking[] = "song_tracking";
 constexpr char kSongENUR128LoudnessAnalysis[] = "song_ebur128_loudness_analysis";
 constexpr char kMarkSongsUnavailable[] = "mark_songs_unavailable";
 constexpr char kExpireUnavailableSongs[] = "expire_unavailable_songs";
 constexpr char kCoverArtPatterns[] = "cover_art_patterns";
 constexpr char kSettingsCacheSize[] = "cache_size";
+constexpr char kSongCacheSize[] = "song_cache_size";
 constexpr char kSettingsCacheSizeUnit[] = "cache_size_unit";
 constexpr char kSettingsDiskCacheEnable[] = "disk_cache_enable";
 constexpr char kSettingsDiskCacheSize[] = "disk_cache_size";
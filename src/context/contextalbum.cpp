@@ -19,6 +19,8 @@
 
 #include "config.h"
 
+#include <cmath>
+
 #include <utility>
 #include <memory>
 
@@ -32,6 +34,9 @@
 #include <QBrush>
 #include <QMovie>
 #include <QTimeLine>
+#include <QtConcurrentRun>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QPainter>
 #include <QSizePolicy>
 #include <QMenu>
@@ -64,7 +69,8 @@ ContextAlbum::ContextAlbum(QWidget *parent)
       image_strawberry_(u":/pictures/strawberry.png"_s),
       image_original_(image_strawberry_),
       pixmap_current_opacity_(1.0),
-      desired_height_(width()) {
+      desired_height_(width()),
+      scale_cover_request_id_(0) {
 
   setObjectName(u"context-widget-album"_s);
 
@@ -107,8 +113,16 @@ void ContextAlbum::paintEvent(QPaintEvent *paint_event) {
   Q_UNUSED(paint_event)
 
   QPainter p(this);
-  p.setRenderHint(QPainter::SmoothPixmapTransform);
-  DrawPreviousCovers(&p);
+  // The pixmaps are pre-scaled to the target size, so filtering is only needed when a fractional
+  // device pixel ratio forces a non-1:1 blit; skipping it keeps the per-frame fade blend cheap.
+  const qreal device_pixel_ratio = devicePixelRatioF();
+  if (!qFuzzyCompare(device_pixel_ratio, std::floor(device_pixel_ratio))) {
+    p.setRenderHint(QPainter::SmoothPixmapTransform);
+  }
+  // While the new cover is fully opaque it covers the previous ones completely.
+  if (pixmap_current_opacity_ < 1.0) {
+    DrawPreviousCovers(&p);
+  }
   DrawImage(&p, pixmap_current_, pixmap_current_opacity_);
   DrawSpinner(&p);
   p.end();
@@ -247,13 +261,28 @@ void ContextAlbum::FadePreviousCoverFinished(SharedPtr<PreviousCover> previous_c
 
 void ContextAlbum::ScaleCover() {
 
-  const QImage image = ImageUtils::ScaleImage(image_original_, QSize(desired_height_, desired_height_), devicePixelRatioF(), true);
-  if (image.isNull()) {
-    pixmap_current_ = QPixmap();
-  }
-  else {
-    pixmap_current_ = QPixmap::fromImage(image);
-  }
+  // Smooth-scaling a large cover takes tens of milliseconds, run it off the UI thread and apply the pixmap when done.
+  const quint64 request_id = ++scale_cover_request_id_;
+  const QImage image_original = image_original_;
+  const QSize desired_size(desired_height_, desired_height_);
+  const qreal device_pixel_ratio = devicePixelRatioF();
+  QFuture<QImage> future = QtConcurrent::run([image_original, desired_size, device_pixel_ratio]() {
+    return ImageUtils::ScaleImage(image_original, desired_size, device_pixel_ratio, true);
+  });
+  QFutureWatcher<QImage> *watcher = new QFutureWatcher<QImage>(this);
+  QObject::connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, request_id]() {
+    const QImage image = watcher->result();
+    watcher->deleteLater();
+    if (request_id != scale_cover_request_id_) return;
+    if (image.isNull()) {
+      pixmap_current_ = QPixmap();
+    }
+    else {
+      pixmap_current_ = QPixmap::fromImage(image);
+    }
+    update();
+  });
+  watcher->setFuture(future);
 
 }
 
@@ -101,6 +101,7 @@ class ContextAlbum : public QWidget {
   QImage image_strawberry_;
   QImage image_original_;
   QPixmap pixmap_current_;
+  quint64 scale_cover_request_id_;
   qreal pixmap_current_opacity_;
   ScopedPtr<QMovie> spinner_animation_;
   int desired_height_;
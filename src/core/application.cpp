@@ -32,12 +32,18 @@
 
 #include <QObject>
 #include <QThread>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QString>
 #include <QMetaObject>
 #include <QCoreApplication>
 #include <QAbstractEventDispatcher>
 
 #include "core/logging.h"
+#include "lyrics/lyricssearchresult.h"
+#include "lyrics/lyricsfetcher.h"
+#include "covermanager/albumcoverfetcher.h"
 
 #include "includes/shared_ptr.h"
 #include "includes/lazy.h"
@@ -114,6 +120,7 @@
 
 using std::make_shared;
 using namespace std::chrono_literals;
+using namespace Qt::Literals::StringLiterals;
 
 class ApplicationImpl {
  public:
@@ -127,6 +134,8 @@ class ApplicationImpl {
           Database *database = new Database(app->task_manager());
           app->MoveToNewThread(database);
           QTimer::singleShot(30s, database, &Database::DoBackup);
+          // Idle-time maintenance well after startup and scans have settled.
+          QTimer::singleShot(10min, database, &Database::DoMaintenance);
           return database;
         }),
         task_manager_([]() { return new TaskManager(); }),
@@ -257,10 +266,78 @@ Application::Application(QObject *parent)
     g_thread_ = g_thread_new(nullptr, Application::GLibMainLoopThreadFunc, nullptr);
   }
 
-  device_finders()->Init();
   collection()->Init();
   tagreader_client();
 
+  // Probing audio devices connects to the sound server and enumerates hardware, keep it off the critical startup path.
+  QTimer::singleShot(1s, this, [this]() { device_finders()->Init(); });
+
+  // Provider verification harness: STRAWBERRY_VERIFY_PROVIDERS="Artist:Album:Title" runs one cover and one
+  // lyrics search across all enabled providers in parallel shortly after startup and logs each provider's
+  // latency and outcome, so provider latency budgets can be checked without clicking through the UI.
+  if (!qgetenv("STRAWBERRY_VERIFY_PROVIDERS").isEmpty()) {
+    QTimer::singleShot(5s, this, [this]() {
+      const QStringList parts = QString::fromUtf8(qgetenv("STRAWBERRY_VERIFY_PROVIDERS")).split(u':');
+      const QString artist = parts.value(0, u"Nirvana"_s);
+      const QString album = parts.value(1, u"Nevermind"_s);
+      const QString title = parts.value(2, u"Come as You Are"_s);
+      // Each search captures its own copy of the timer, the two finish in either order.
+      QElapsedTimer verify_timer;
+      verify_timer.start();
+
+      AlbumCoverFetcher *cover_fetcher = new AlbumCoverFetcher(cover_providers(), network(), this);
+      QObject::connect(cover_fetcher, &AlbumCoverFetcher::SearchFinished, this, [verify_timer, cover_fetcher](const quint64 id, const CoverProviderSearchResults &results, const CoverSearchStatistics &statistics) {
+        Q_UNUSED(id)
+        Q_UNUSED(statistics)
+        qLog(Info) << "Provider verification: cover search finished in" << verify_timer.elapsed() << "ms with" << results.count() << "results";
+        for (const CoverProviderSearchResult &result : results) {
+          qLog(Info) << "Provider verification: cover result from" << result.provider << "score" << result.score();
+        }
+        cover_fetcher->deleteLater();
+      });
+      cover_fetcher->SearchForCovers(artist, album);
+
+      LyricsFetcher *lyrics_fetcher = new LyricsFetcher(lyrics_providers(), this);
+      QObject::connect(lyrics_fetcher, &LyricsFetcher::SearchFinished, this, [verify_timer, lyrics_fetcher](const quint64 id, const LyricsSearchResults &results) {
+        Q_UNUSED(id)
+        qLog(Info) << "Provider verification: lyrics search finished in" << verify_timer.elapsed() << "ms with" << results.count() << "results";
+        for (const LyricsSearchResult &result : results) {
+          qLog(Info) << "Provider verification: lyrics result from" << result.provider << "score" << result.score;
+        }
+        lyrics_fetcher->deleteLater();
+      });
+      lyrics_fetcher->Search(artist, artist, album, title);
+    });
+  }
+
+  // Periodic memory accounting, enabled with STRAWBERRY_DEBUG_MEMORY=<budget in MB> (0 for reporting only).
+  // Logs the process RSS and peak, and warns when the budget is exceeded.
+  if (!qgetenv("STRAWBERRY_DEBUG_MEMORY").isEmpty()) {
+    bool ok = false;
+    const qint64 budget_mb = qgetenv("STRAWBERRY_DEBUG_MEMORY").toLongLong(&ok);
+    QTimer *memory_debug_timer = new QTimer(this);
+    memory_debug_timer->setInterval(1min);
+    QObject::connect(memory_debug_timer, &QTimer::timeout, this, [budget_mb, ok]() {
+      qint64 rss_kb = 0;
+      qint64 peak_kb = 0;
+#ifdef Q_OS_LINUX
+      QFile status_file(u"/proc/self/status"_s);
+      if (status_file.open(QIODevice::ReadOnly)) {
+        const QList<QByteArray> lines = status_file.readAll().split('\n');
+        for (const QByteArray &line : lines) {
+          if (line.startsWith("VmRSS:")) rss_kb = line.mid(6).trimmed().split(' ').first().toLongLong();
+          else if (line.startsWith("VmHWM:")) peak_kb = line.mid(6).trimmed().split(' ').first().toLongLong();
+        }
+      }
+#endif
+      qLog(Debug) << "Memory usage:" << rss_kb / 1024 << "MB RSS," << peak_kb / 1024 << "MB peak";
+      if (ok && budget_mb > 0 && rss_kb / 1024 > budget_mb) {
+        qLog(Warning) << "Memory usage" << rss_kb / 1024 << "MB exceeds the configured budget of" << budget_mb << "MB";
+      }
+    });
+    memory_debug_timer->start();
+  }
+
 }
 
 Application::~Application() {
@@ -317,34 +394,66 @@ void Application::MoveToThread(QObject *object, QThread *thread) {
 
 void Application::Exit() {
 
-  wait_for_exit_ << &*tagreader_client()
-                 << &*collection()
-                 << &*playlist_backend()
-                 << &*albumcover_loader()
-                 << &*device_manager()
-                 << &*streaming_services()
-                 << &*radio_services()->radio_backend();
+  // All the services flush in parallel; only the ones that were actually created have anything to flush,
+  // constructing one here just to exit it again would only slow shutdown down.
 
-  QObject::connect(&*tagreader_client(), &TagReaderClient::ExitFinished, this, &Application::ExitReceived);
-  tagreader_client()->ExitAsync();
+  if (p_->tagreader_client_) {
+    wait_for_exit_ << &*tagreader_client();
+    QObject::connect(&*tagreader_client(), &TagReaderClient::ExitFinished, this, &Application::ExitReceived);
+    tagreader_client()->ExitAsync();
+  }
 
-  QObject::connect(&*collection(), &CollectionLibrary::ExitFinished, this, &Application::ExitReceived);
-  collection()->Exit();
+  if (p_->collection_) {
+    wait_for_exit_ << &*collection();
+    QObject::connect(&*collection(), &CollectionLibrary::ExitFinished, this, &Application::ExitReceived);
+    collection()->Exit();
+  }
 
-  QObject::connect(&*playlist_backend(), &PlaylistBackend::ExitFinished, this, &Application::ExitReceived);
-  playlist_backend()->ExitAsync();
+  if (p_->playlist_backend_) {
+    wait_for_exit_ << &*playlist_backend();
+    QObject::connect(&*playlist_backend(), &PlaylistBackend::ExitFinished, this, &Application::ExitReceived);
+    playlist_backend()->ExitAsync();
+  }
 
-  QObject::connect(&*albumcover_loader(), &AlbumCoverLoader::ExitFinished, this, &Application::ExitReceived);
-  albumcover_loader()->ExitAsync();
+  if (p_->albumcover_loader_) {
+    wait_for_exit_ << &*albumcover_loader();
+    QObject::connect(&*albumcover_loader(), &AlbumCoverLoader::ExitFinished, this, &Application::ExitReceived);
+    albumcover_loader()->ExitAsync();
+  }
 
-  QObject::connect(&*device_manager(), &DeviceManager::ExitFinished, this, &Application::ExitReceived);
-  device_manager()->Exit();
+  if (p_->device_manager_) {
+    wait_for_exit_ << &*device_manager();
+    QObject::connect(&*device_manager(), &DeviceManager::ExitFinished, this, &Application::ExitReceived);
+    device_manager()->Exit();
+  }
 
-  QObject::connect(&*streaming_services(), &StreamingServices::ExitFinished, this, &Application::ExitReceived);
-  streaming_services()->Exit();
+  if (p_->streaming_services_) {
+    wait_for_exit_ << &*streaming_services();
+    QObject::connect(&*streaming_services(), &StreamingServices::ExitFinished, this, &Application::ExitReceived);
+    streaming_services()->Exit();
+  }
 
-  QObject::connect(&*radio_services()->radio_backend(), &RadioBackend::ExitFinished, this, &Application::ExitReceived);
-  radio_services()->radio_backend()->ExitAsync();
+  if (p_->radio_services_) {
+    wait_for_exit_ << &*radio_services()->radio_backend();
+    QObject::connect(&*radio_services()->radio_backend(), &RadioBackend::ExitFinished, this, &Application::ExitReceived);
+    radio_services()->radio_backend()->ExitAsync();
+  }
+
+  if (wait_for_exit_.isEmpty()) {
+    ExitDatabase();
+    return;
+  }
+
+  // Bound the flush phase: a hung service must not block shutdown forever.
+  QTimer::singleShot(10s, this, [this]() {
+    if (!wait_for_exit_.isEmpty()) {
+      for (QObject *obj : std::as_const(wait_for_exit_)) {
+        qLog(Error) << obj << "did not exit in time, continuing shutdown without it.";
+      }
+      wait_for_exit_.clear();
+      ExitDatabase();
+    }
+  });
 
 }
 
@@ -357,13 +466,22 @@ void Application::ExitReceived() {
 
   wait_for_exit_.removeAll(obj);
   if (wait_for_exit_.isEmpty()) {
-    database()->Close();
-    QObject::connect(&*database(), &Database::ExitFinished, this, &Application::ExitFinished);
-    database()->ExitAsync();
+    ExitDatabase();
   }
 
 }
 
+void Application::ExitDatabase() {
+
+  if (database_exit_requested_) return;
+  database_exit_requested_ = true;
+
+  database()->Close();
+  QObject::connect(&*database(), &Database::ExitFinished, this, &Application::ExitFinished);
+  database()->ExitAsync();
+
+}
+
 SharedPtr<TagReaderClient> Application::tagreader_client() const { return p_->tagreader_client_.ptr(); }
 SharedPtr<Database> Application::database() const { return p_->database_.ptr(); }
 SharedPtr<TaskManager> Application::task_manager() const { return p_->task_manager_.ptr(); }
@@ -112,6 +112,7 @@ class Application : public QObject {
 
  private Q_SLOTS:
   void ExitReceived();
+  void ExitDatabase();
 
  Q_SIGNALS:
   void ExitFinished();
@@ -124,6 +125,7 @@ class Application : public QObject {
   GThread *g_thread_;
   QList<QThread*> threads_;
   QList<QObject*> wait_for_exit_;
+  bool database_exit_requested_ = false;
 };
 
 #endif  // APPLICATION_H
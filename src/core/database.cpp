@@ -22,6 +22,7 @@
 #include "config.h"
 
 #include <utility>
+#include <memory>
 
 #include <sqlite3.h>
 
@@ -50,7 +51,7 @@
 
 using namespace Qt::Literals::StringLiterals;
 
-const int Database::kSchemaVersion = 20;
+const int Database::kSchemaVersion = 22;
 
 namespace {
 constexpr char kDatabaseFilename[] = "strawberry.db";
@@ -148,6 +149,23 @@ QSqlDatabase Database::Connect() {
     return db;
   }
 
+  {
+    // Use WAL so that collection scans writing on one connection don't block readers on the per-thread connections, which would stall the UI.
+    SqlQuery q(db);
+    q.prepare(u"PRAGMA journal_mode=WAL"_s);
+    if (q.Exec() && q.next() && q.value(0).toString().compare(u"wal"_s, Qt::CaseInsensitive) != 0) {
+      qLog(Warning) << "Could not set database journal mode to WAL, using" << q.value(0).toString();
+    }
+  }
+  {
+    // In WAL mode NORMAL still guarantees consistency and avoids an fsync on every transaction commit.
+    SqlQuery q(db);
+    q.prepare(u"PRAGMA synchronous=NORMAL"_s);
+    if (!q.Exec()) {
+      ReportErrors(q);
+    }
+  }
+
   if (db.tables().count() == 0) {
     // Set up initial schema
     qLog(Info) << "Creating initial database schema";
@@ -198,12 +216,42 @@ QSqlDatabase Database::Connect() {
 
 }
 
+SqlQuery *Database::CachedQuery(const QSqlDatabase &db, const QString &sql) {
+
+  const QString key = db.connectionName() + QLatin1Char('|') + sql;
+
+  QMutexLocker l(&mutex_cached_queries_);
+  if (cached_queries_.contains(key)) {
+    return &*cached_queries_[key];
+  }
+
+  std::shared_ptr<SqlQuery> query = std::make_shared<SqlQuery>(db);
+  query->prepare(sql);
+  cached_queries_.insert(key, query);
+
+  return &*query;
+
+}
+
 void Database::Close() {
 
   QMutexLocker l(&connect_mutex_);
 
   const QString connection_id = QStringLiteral("%1_thread_%2").arg(connection_id_).arg(reinterpret_cast<quint64>(QThread::currentThread()));
 
+  // Drop any statements prepared on this connection before it goes away.
+  {
+    QMutexLocker cached_queries_locker(&mutex_cached_queries_);
+    for (QHash<QString, std::shared_ptr<SqlQuery>>::iterator it = cached_queries_.begin(); it != cached_queries_.end();) {
+      if (it.key().startsWith(connection_id + QLatin1Char('|'))) {
+        it = cached_queries_.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+
   // Try to find an existing connection for this thread
   if (QSqlDatabase::connectionNames().contains(connection_id)) {
     {
@@ -524,6 +572,36 @@ bool Database::IntegrityCheck(const QSqlDatabase &db) {
 
 }
 
+void Database::DoMaintenance() {
+
+  QSqlDatabase db(Connect());
+  if (!db.isOpen()) return;
+
+  QMutexLocker l(&mutex_);
+
+  qLog(Debug) << "Running database maintenance";
+
+  {
+    // Refreshes the query planner statistics for whichever indexes were used since the last run,
+    // which keeps the collection queries on good plans as the library grows.
+    SqlQuery q(db);
+    q.prepare(u"PRAGMA optimize"_s);
+    if (!q.Exec()) {
+      ReportErrors(q);
+    }
+  }
+
+  {
+    // Trims the WAL back so it doesn't keep the high-water mark of the last scan.
+    SqlQuery q(db);
+    q.prepare(u"PRAGMA wal_checkpoint(TRUNCATE)"_s);
+    if (!q.Exec()) {
+      ReportErrors(q);
+    }
+  }
+
+}
+
 void Database::DoBackup() {
 
   QSqlDatabase db(Connect());
@@ -24,11 +24,14 @@
 
 #include "config.h"
 
+#include <memory>
+
 #include <sqlite3.h>
 
 #include <QtGlobal>
 #include <QObject>
 #include <QMutex>
+#include <QHash>
 #include <QMap>
 #include <QSqlDatabase>
 #include <QSqlQuery>
@@ -66,6 +69,11 @@ class Database : public QObject {
   void Close();
   void ReportErrors(const SqlQuery &query);
 
+  // Returns a prepared statement for the given SQL, cached per connection so hot queries skip re-compilation.
+  // The returned query is owned by the cache; callers re-bind values and Exec() it.
+  // The same SQL must not be used recursively on the same connection.
+  SqlQuery *CachedQuery(const QSqlDatabase &db, const QString &sql);
+
   QRecursiveMutex *Mutex() { return &mutex_; }
 
   void RecreateAttachedDb(const QString &database_name);
@@ -88,6 +96,7 @@ class Database : public QObject {
 
  public Q_SLOTS:
   void DoBackup();
+  void DoMaintenance();
 
  private:
   static int SchemaVersion(QSqlDatabase *db);
@@ -125,6 +134,9 @@ class Database : public QObject {
   QStringList query_cache_;
 
   // This is the schema version of Strawberry's DB from the app's last run.
+  QHash<QString, std::shared_ptr<SqlQuery>> cached_queries_;
+  QMutex mutex_cached_queries_;
+
   int startup_schema_version_;
 
   QThread *original_thread_;
@@ -28,14 +28,33 @@
 #include <QFileInfo>
 #include <QString>
 
+#include <QStorageInfo>
+
 #include "core/logging.h"
 #include "utilities/fileutils.h"
+#include "utilities/strutils.h"
 #include "musicstorage.h"
 
 #include "filesystemmusicstorage.h"
 
 FilesystemMusicStorage::FilesystemMusicStorage(const Song::Source source, const QString &root, const std::optional<int> collection_directory_id) : source_(source), root_(root), collection_directory_id_(collection_directory_id) {}
 
+bool FilesystemMusicStorage::CheckFreeSpace(const qint64 bytes_required, QString &error_text) {
+
+  const QStorageInfo storage_info(root_);
+  if (!storage_info.isValid()) return true;
+
+  // Leave a little margin so the copy doesn't fill the volume to the last byte.
+  constexpr qint64 kFreeSpaceMargin = 100LL * 1024LL * 1024LL;
+  if (storage_info.bytesAvailable() >= bytes_required + kFreeSpaceMargin) return true;
+
+  error_text = QObject::tr("Not enough free space on %1: %2 needed, %3 available.").arg(root_, Utilities::PrettySize(static_cast<quint64>(bytes_required)), Utilities::PrettySize(static_cast<quint64>(storage_info.bytesAvailable())));
+  qLog(Error) << error_text;
+
+  return false;
+
+}
+
 bool FilesystemMusicStorage::CopyToStorage(const CopyJob &job, QString &error_text) {
 
   const QFileInfo src = QFileInfo(job.source_);
@@ -93,14 +112,14 @@ bool FilesystemMusicStorage::CopyToStorage(const CopyJob &job, QString &error_te
       qLog(Error) << error_text;
     }
     else {
-      result = QFile::copy(src.absoluteFilePath(), dest.absoluteFilePath());
+      result = Utilities::CloneOrCopyFile(src.absoluteFilePath(), dest.absoluteFilePath());
       if (!result) {
         error_text = QObject::tr("Could not copy file %1 to %2.").arg(src.absoluteFilePath(), dest.absoluteFilePath());
         qLog(Error) << error_text;
       }
     }
     if ((!cover_dest.exists() || job.overwrite_) && !cover_src.filePath().isEmpty() && !cover_dest.filePath().isEmpty()) {
-      QFile::copy(cover_src.absoluteFilePath(), cover_dest.absoluteFilePath());
+      Utilities::CloneOrCopyFile(cover_src.absoluteFilePath(), cover_dest.absoluteFilePath());
     }
   }
 
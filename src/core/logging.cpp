@@ -146,8 +146,14 @@ static void MessageHandler(QtMsgType type, const QMessageLogContext &message_log
 
   if (message.startsWith(QLatin1String(kMessageHandlerMagic))) {
     QByteArray message_data = message.toUtf8();
-    fprintf(type == QtCriticalMsg || type == QtFatalMsg ? stderr : stdout, "%s\n", message_data.constData() + kMessageHandlerMagicLen);
-    fflush(type == QtCriticalMsg || type == QtFatalMsg ? stderr : stdout);
+    // Only errors are flushed explicitly, ordinary messages rely on line buffering so logging stays cheap on hot paths.
+    if (type == QtCriticalMsg || type == QtFatalMsg) {
+      fprintf(stderr, "%s\n", message_data.constData() + kMessageHandlerMagicLen);
+      fflush(stderr);
+    }
+    else {
+      fprintf(stdout, "%s\n", message_data.constData() + kMessageHandlerMagicLen);
+    }
     return;
   }
 
@@ -172,8 +178,13 @@ static void MessageHandler(QtMsgType type, const QMessageLogContext &message_log
     d << line.toLocal8Bit().constData();
     if (d.buf_) {
       d.buf_->close();
-      fprintf(type == QtCriticalMsg || type == QtFatalMsg ? stderr : stdout, "%s\n", d.buf_->buffer().constData());
-      fflush(type == QtCriticalMsg || type == QtFatalMsg ? stderr : stdout);
+      if (type == QtCriticalMsg || type == QtFatalMsg) {
+        fprintf(stderr, "%s\n", d.buf_->buffer().constData());
+        fflush(stderr);
+      }
+      else {
+        fprintf(stdout, "%s\n", d.buf_->buffer().constData());
+      }
     }
   }
 
@@ -192,6 +203,9 @@ void Init() {
   sNullDevice = new NullDevice;
   sNullDevice->open(QIODevice::ReadWrite);
 
+  // Line-buffer stdout so log lines appear promptly without an explicit flush per message.
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
   // Catch other messages from Qt
   if (!sOriginalMessageHandler) {
     sOriginalMessageHandler = qInstallMessageHandler(MessageHandler);
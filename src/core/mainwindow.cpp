@@ -1414,7 +1414,7 @@ void MainWindow::MediaPaused() {
     track_position_timer_->start();
   }
   if (!track_slider_timer_->isActive()) {
-    track_slider_timer_->start();
+    if (isVisible()) track_slider_timer_->start();
   }
 
   tray_icon_->SetPaused();
@@ -1444,7 +1444,7 @@ void MainWindow::MediaPlaying() {
     track_position_timer_->start();
   }
   if (!track_slider_timer_->isActive()) {
-    track_slider_timer_->start();
+    if (isVisible()) track_slider_timer_->start();
   }
 
   UpdateTrackPosition();
@@ -1636,6 +1636,12 @@ void MainWindow::StopAfterCurrent() {
 
 void MainWindow::showEvent(QShowEvent *e) {
 
+  // Resume the slider updates that were paused while the window was hidden.
+  if (app_->player()->GetState() == EngineBase::State::Playing && !track_slider_timer_->isActive()) {
+    UpdateTrackSliderPosition();
+    if (isVisible()) track_slider_timer_->start();
+  }
+
   QMainWindow::showEvent(e);
 
 }
@@ -1648,6 +1654,12 @@ void MainWindow::hideEvent(QHideEvent *e) {
   was_maximized_ = isMaximized();
   was_minimized_ = isMinimized();
 
+  // Nothing shows the slider while the window is hidden, stop waking up five times a second for it.
+  // The once-a-second position timer keeps running for the tray progress and scrobbling.
+  if (track_slider_timer_->isActive()) {
+    track_slider_timer_->stop();
+  }
+
   QMainWindow::hideEvent(e);
 
 }
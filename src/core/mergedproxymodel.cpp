@@ -40,7 +40,6 @@
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/tag.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/operators.hpp>
@@ -50,7 +49,6 @@ using boost::multi_index::identity;
 using boost::multi_index::indexed_by;
 using boost::multi_index::member;
 using boost::multi_index::multi_index_container;
-using boost::multi_index::ordered_unique;
 using boost::multi_index::tag;
 
 size_t hash_value(const QModelIndex &idx) { return qHash(idx); }
@@ -70,7 +68,8 @@ struct tag_by_pointer {};
 
 class MergedProxyModelPrivate {
  private:
-  using MappingContainer = multi_index_container<Mapping*, indexed_by<hashed_unique<tag<tag_by_source>, member<Mapping, QModelIndex, &Mapping::source_index>>, ordered_unique<tag<tag_by_pointer>, identity<Mapping*>>>>;
+  // Both indexes are hashed: lookups by source index and by pointer are O(1), and nothing relies on iteration order.
+  using MappingContainer = multi_index_container<Mapping*, indexed_by<hashed_unique<tag<tag_by_source>, member<Mapping, QModelIndex, &Mapping::source_index>>, hashed_unique<tag<tag_by_pointer>, identity<Mapping*>>>>;
 
  public:
   MappingContainer mappings_;
@@ -88,6 +88,9 @@ class MusicStorage {
   virtual Song::FileType GetTranscodeFormat() const { return Song::FileType::Unknown; }
   virtual bool GetSupportedFiletypes(QList<Song::FileType> *ret) { Q_UNUSED(ret); return true; }
 
+  // Preflight check that the destination can hold the given number of bytes, so a copy batch fails fast instead of part-way through.
+  virtual bool CheckFreeSpace(const qint64 bytes_required, QString &error_text) { Q_UNUSED(bytes_required); Q_UNUSED(error_text); return true; }
+
   virtual bool StartCopy(QList<Song::FileType> *supported_types) { Q_UNUSED(supported_types); return true; }
   virtual bool CopyToStorage(const CopyJob &job, QString &error_text) = 0;
   virtual bool FinishCopy(bool success, QString &error_text) { Q_UNUSED(error_text); return success; }
@@ -27,6 +27,7 @@
 #include <QByteArray>
 #include <QString>
 #include <QNetworkAccessManager>
+#include <QHostInfo>
 #include <QNetworkRequest>
 #include <QNetworkReply>
 
@@ -43,6 +44,29 @@ NetworkAccessManager::NetworkAccessManager(QObject *parent)
 
 }
 
+void NetworkAccessManager::PreResolve(const QUrl &url) {
+
+  if (!url.isValid() || url.host().isEmpty()) return;
+
+  QHostInfo::lookupHost(url.host(), QCoreApplication::instance(), [](const QHostInfo&) {});
+
+}
+
+void NetworkAccessManager::PreConnect(const QUrl &url) {
+
+  if (!url.isValid() || url.host().isEmpty()) return;
+
+  if (url.scheme() == "https"_L1) {
+#ifndef QT_NO_SSL
+    connectToHostEncrypted(url.host(), static_cast<quint16>(url.port(443)));
+#endif
+  }
+  else if (url.scheme() == "http"_L1) {
+    connectToHost(url.host(), static_cast<quint16>(url.port(80)));
+  }
+
+}
+
 QNetworkReply *NetworkAccessManager::createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData) {
 
   QByteArray user_agent;
@@ -55,6 +79,8 @@ QNetworkReply *NetworkAccessManager::createRequest(Operation op, const QNetworkR
 
   QNetworkRequest new_request(request);
   new_request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::NoLessSafeRedirectPolicy);
+  // Allow HTTP/2 so concurrent requests to the same host multiplex over one connection instead of opening one each.
+  new_request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
   new_request.setHeader(QNetworkRequest::UserAgentHeader, user_agent);
 
   if (op == QNetworkAccessManager::PostOperation && !new_request.header(QNetworkRequest::ContentTypeHeader).isValid()) {
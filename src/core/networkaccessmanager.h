@@ -28,6 +28,8 @@
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
 
+#include <QUrl>
+
 class QIODevice;
 class QNetworkReply;
 
@@ -37,6 +39,14 @@ class NetworkAccessManager : public QNetworkAccessManager {
  public:
   explicit NetworkAccessManager(QObject *parent = nullptr);
 
+  // Starts an asynchronous DNS lookup for the URL's host so the resolver cache is warm
+  // before any connection attempt; cheap enough to call as soon as an endpoint is known.
+  static void PreResolve(const QUrl &url);
+
+  // Opens (or reuses) a connection to the URL's host ahead of the first request, so the TCP and TLS
+  // handshakes are out of the way when the request is made.
+  void PreConnect(const QUrl &url);
+
  protected:
   QNetworkReply *createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData) override;
 };
@@ -933,6 +933,30 @@ void Player::TrackAboutToEnd() {
     // If the next track is on the same album (or same cue file),
     // and the user doesn't want to crossfade between tracks on the same album, then don't do this automatic crossfading.
     if (engine_->crossfade_same_album() || !has_next_row || !next_item || !current_item_->Metadata().IsOnSameAlbum(next_item->Metadata())) {
+      // Resolve the next track's stream URL before starting the transition, so for streaming
+      // services the lookup overlaps the fadeout instead of delaying the new track.
+      if (next_item) {
+        const QUrl next_url = next_item->StreamUrl();
+        if (url_handlers_->CanHandle(next_url) && !loading_async_.contains(next_url)) {
+          UrlHandler *url_handler = url_handlers_->GetUrlHandler(next_url);
+          const UrlHandler::LoadResult result = url_handler->StartLoading(next_url);
+          switch (result.type_) {
+            case UrlHandler::LoadResult::Type::TrackAvailable:{
+              Song song = next_item->Metadata();
+              song.set_stream_url(result.stream_url_);
+              next_item->SetTemporaryMetadata(song);
+              break;
+            }
+            case UrlHandler::LoadResult::Type::WillLoadAsynchronously:
+              // Mark the URL as in flight so the PlayAt that follows waits for this result
+              // instead of issuing a duplicate request whose late reply would restart the track.
+              loading_async_ << next_url;
+              break;
+            default:
+              break;
+          }
+        }
+      }
       TrackEnded();
       return;
     }
@@ -21,6 +21,8 @@
 #include "config.h"
 
 #include <QFileSystemWatcher>
+#include <QSet>
+#include <QTimer>
 #include <QString>
 
 #include "core/logging.h"
@@ -29,7 +31,30 @@
 
 QtFSListener::QtFSListener(QObject *parent) : FileSystemWatcherInterface(parent), watcher_(this) {
 
-  QObject::connect(&watcher_, &QFileSystemWatcher::directoryChanged, this, &QtFSListener::PathChanged);
+  timer_flush_.setSingleShot(true);
+  timer_flush_.setInterval(500);
+  QObject::connect(&timer_flush_, &QTimer::timeout, this, &QtFSListener::FlushChangedPaths);
+
+  QObject::connect(&watcher_, &QFileSystemWatcher::directoryChanged, this, &QtFSListener::DirectoryChanged);
+
+}
+
+void QtFSListener::DirectoryChanged(const QString &path) {
+
+  changed_paths_ << path;
+  if (!timer_flush_.isActive()) {
+    timer_flush_.start();
+  }
+
+}
+
+void QtFSListener::FlushChangedPaths() {
+
+  const QSet<QString> changed_paths = changed_paths_;
+  changed_paths_.clear();
+  for (const QString &path : changed_paths) {
+    Q_EMIT PathChanged(path);
+  }
 
 }
 
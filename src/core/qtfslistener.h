@@ -25,7 +25,9 @@
 
 #include <QObject>
 #include <QFileSystemWatcher>
+#include <QSet>
 #include <QString>
+#include <QTimer>
 
 #include "filesystemwatcherinterface.h"
 
@@ -38,8 +40,16 @@ class QtFSListener : public FileSystemWatcherInterface {
   void RemovePath(const QString &path) override;
   void Clear() override;
 
+ private Q_SLOTS:
+  void DirectoryChanged(const QString &path);
+  void FlushChangedPaths();
+
  private:
   QFileSystemWatcher watcher_;
+  // Bursts of native events, for example while files are copied into a watched directory,
+  // are coalesced into one PathChanged per directory per flush window.
+  QSet<QString> changed_paths_;
+  QTimer timer_flush_;
 
 };
 
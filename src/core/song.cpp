@@ -42,11 +42,16 @@
 #include <QVariantMap>
 #include <QString>
 #include <QStringList>
+#include <QSet>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
 #include <QUrl>
 #include <QIcon>
 #include <QStandardPaths>
 #include <QSqlRecord>
+#include <QDateTime>
 
 #include <taglib/tstring.h>
 
@@ -669,11 +674,49 @@ bool Song::stream_url_can_expire() const { return d->source_ == Source::Tidal ||
 bool Song::is_module_music() const { return d->filetype_ == FileType::MOD || d->filetype_ == FileType::S3M || d->filetype_ == FileType::XM || d->filetype_ == FileType::IT; }
 bool Song::has_cue() const { return !d->cue_path_.isEmpty(); }
 
+namespace {
+
+// The same art file gets its validity checked once per song of its album, both while scanning and while painting.
+// Remember recent existence results briefly so an album costs one stat instead of one per track.
+bool ArtFileExists(const QString &path) {
+
+  struct CacheEntry {
+    qint64 timestamp;
+    bool exists;
+  };
+  static QMutex mutex;
+  static QHash<QString, CacheEntry> cache;
+
+  constexpr qint64 kEntryTTLMsecs = 5000;
+  const qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+  {
+    QMutexLocker l(&mutex);
+    const QHash<QString, CacheEntry>::const_iterator it = cache.constFind(path);
+    if (it != cache.constEnd() && now - it->timestamp < kEntryTTLMsecs) {
+      return it->exists;
+    }
+  }
+
+  const bool exists = QFile::exists(path);
+
+  {
+    QMutexLocker l(&mutex);
+    if (cache.count() > 10000) cache.clear();
+    cache.insert(path, CacheEntry{now, exists});
+  }
+
+  return exists;
+
+}
+
+}  // namespace
+
 bool Song::art_automatic_is_valid() const {
-  return !d->art_automatic_.isEmpty() && d->art_automatic_.isValid() && (!d->art_automatic_.isLocalFile() || (d->art_automatic_.isLocalFile() && QFile::exists(d->art_automatic_.toLocalFile())));
+  return !d->art_automatic_.isEmpty() && d->art_automatic_.isValid() && (!d->art_automatic_.isLocalFile() || ArtFileExists(d->art_automatic_.toLocalFile()));
 }
 bool Song::art_manual_is_valid() const {
-  return !d->art_manual_.isEmpty() && d->art_manual_.isValid() && (!d->art_manual_.isLocalFile() || (d->art_manual_.isLocalFile() && QFile::exists(d->art_manual_.toLocalFile())));
+  return !d->art_manual_.isEmpty() && d->art_manual_.isValid() && (!d->art_manual_.isLocalFile() || ArtFileExists(d->art_manual_.toLocalFile()));
 }
 bool Song::has_valid_art() const { return art_embedded() || art_automatic_is_valid() || art_manual_is_valid(); }
 void Song::clear_art_automatic() { d->art_automatic_.clear(); }
@@ -802,7 +845,18 @@ QString Song::sortable(const QString &v) {
 
 int Song::ColumnIndex(const QString &field) {
 
-  return static_cast<int>(kRowIdColumns.indexOf(field));
+  // Called for every field of every row constructed from a query; a linear scan over the column list
+  // per field made loading a row quadratic in the column count.
+  static const QHash<QString, int> indexes = []() {
+    QHash<QString, int> hash;
+    hash.reserve(kRowIdColumns.count());
+    for (int i = 0; i < kRowIdColumns.count(); ++i) {
+      hash.insert(kRowIdColumns[i], i);
+    }
+    return hash;
+  }();
+
+  return indexes.value(field, -1);
 
 }
 
@@ -916,6 +970,10 @@ bool Song::IsEditable() const {
 
 bool Song::IsMetadataEqual(const Song &other) const {
 
+  // Copies share their data until one is modified, so pointer identity proves equality
+  // and spares the field-by-field comparison in the common unchanged case.
+  if (d == other.d) return true;
+
   return d->title_ == other.d->title_ &&
     d->album_ == other.d->album_ &&
     d->artist_ == other.d->artist_ &&
@@ -944,6 +1002,8 @@ bool Song::IsMetadataEqual(const Song &other) const {
 
 bool Song::IsPlayStatisticsEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->playcount_ == other.d->playcount_ &&
     d->skipcount_ == other.d->skipcount_ &&
     d->lastplayed_ == other.d->lastplayed_;
@@ -952,24 +1012,32 @@ bool Song::IsPlayStatisticsEqual(const Song &other) const {
 
 bool Song::IsRatingEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->rating_ == other.d->rating_;
 
 }
 
 bool Song::IsFingerprintEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->fingerprint_ == other.d->fingerprint_;
 
 }
 
 bool Song::IsAcoustIdEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->acoustid_id_ == other.d->acoustid_id_ && d->acoustid_fingerprint_ == other.d->acoustid_fingerprint_;
 
 }
 
 bool Song::IsMusicBrainzEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->musicbrainz_album_artist_id_ == other.d->musicbrainz_album_artist_id_ &&
     d->musicbrainz_artist_id_ == other.d->musicbrainz_artist_id_ &&
     d->musicbrainz_original_artist_id_ == other.d->musicbrainz_original_artist_id_ &&
@@ -985,6 +1053,8 @@ bool Song::IsMusicBrainzEqual(const Song &other) const {
 
 bool Song::IsEBUR128Equal(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->ebur128_integrated_loudness_lufs_ == other.d->ebur128_integrated_loudness_lufs_ &&
     d->ebur128_loudness_range_lu_ == other.d->ebur128_loudness_range_lu_;
 
@@ -992,6 +1062,8 @@ bool Song::IsEBUR128Equal(const Song &other) const {
 
 bool Song::IsArtEqual(const Song &other) const {
 
+  if (d == other.d) return true;
+
   return d->art_embedded_ == other.d->art_embedded_ &&
     d->art_automatic_ == other.d->art_automatic_ &&
     d->art_manual_ == other.d->art_manual_ &&
@@ -1392,6 +1464,34 @@ void Song::Init(const QString &title, const QString &artist, const QString &albu
 
 }
 
+namespace {
+
+// A large collection repeats the same artist, album and genre strings across thousands of songs.
+// Interning them while loading makes equal values share one allocation instead of one copy per row.
+QString InternMetadataString(const QString &value) {
+
+  if (value.isEmpty()) return value;
+
+  static QMutex mutex;
+  static QSet<QString> pool;
+
+  QMutexLocker l(&mutex);
+  const QSet<QString>::const_iterator it = pool.constFind(value);
+  if (it != pool.constEnd()) return *it;
+  pool.insert(value);
+
+  return value;
+
+}
+
+}  // namespace
+
+QString Song::Intern(const QString &value) {
+
+  return InternMetadataString(value);
+
+}
+
 void Song::InitFromQuery(const QSqlRecord &r, const bool reliable_metadata, const int col) {
 
   Q_ASSERT(kRowIdColumns.count() + col <= r.count());
@@ -1399,18 +1499,18 @@ void Song::InitFromQuery(const QSqlRecord &r, const bool reliable_metadata, cons
   d->id_ = SqlHelper::ValueToInt(r, ColumnIndex(u"ROWID"_s) + col);
 
   set_title(SqlHelper::ValueToString(r, ColumnIndex(u"title"_s) + col));
-  set_album(SqlHelper::ValueToString(r, ColumnIndex(u"album"_s) + col));
-  set_artist(SqlHelper::ValueToString(r, ColumnIndex(u"artist"_s) + col));
-  set_albumartist(SqlHelper::ValueToString(r, ColumnIndex(u"albumartist"_s) + col));
+  set_album(InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"album"_s) + col)));
+  set_artist(InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"artist"_s) + col)));
+  set_albumartist(InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"albumartist"_s) + col)));
   d->track_ = SqlHelper::ValueToInt(r, ColumnIndex(u"track"_s) + col);
   d->disc_ = SqlHelper::ValueToInt(r, ColumnIndex(u"disc"_s) + col);
   d->year_ = SqlHelper::ValueToInt(r, ColumnIndex(u"year"_s) + col);
   d->originalyear_ = SqlHelper::ValueToInt(r, ColumnIndex(u"originalyear"_s) + col);
-  d->genre_ = SqlHelper::ValueToString(r, ColumnIndex(u"genre"_s) + col);
+  d->genre_ = InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"genre"_s) + col));
   d->compilation_ = r.value(ColumnIndex(u"compilation"_s) + col).toBool();
-  d->composer_ = SqlHelper::ValueToString(r, ColumnIndex(u"composer"_s) + col);
-  d->performer_ = SqlHelper::ValueToString(r, ColumnIndex(u"performer"_s) + col);
-  d->grouping_ = SqlHelper::ValueToString(r, ColumnIndex(u"grouping"_s) + col);
+  d->composer_ = InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"composer"_s) + col));
+  d->performer_ = InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"performer"_s) + col));
+  d->grouping_ = InternMetadataString(SqlHelper::ValueToString(r, ColumnIndex(u"grouping"_s) + col));
   d->comment_ = SqlHelper::ValueToString(r, ColumnIndex(u"comment"_s) + col);
   d->lyrics_ = SqlHelper::ValueToString(r, ColumnIndex(u"lyrics"_s) + col);
   d->artist_id_ = SqlHelper::ValueToString(r, ColumnIndex(u"artist_id"_s) + col);
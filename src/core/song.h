@@ -404,6 +404,8 @@ class Song {
 
   static int ColumnIndex(const QString &field);
   static QString JoinSpec(const QString &table);
+  // Interns a metadata string through a shared pool, so equal artist/album/genre values share one allocation.
+  static QString Intern(const QString &value);
 
   // Pretty accessors
   QString PrettyTitle() const;
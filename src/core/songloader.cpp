@@ -34,6 +34,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QSet>
+#include <QHash>
 #include <QTimer>
 #include <QString>
 #include <QUrl>
@@ -158,10 +159,12 @@ SongLoader::Result SongLoader::LoadLocalPartial(const QString &filename) {
     return Result::Success;
   }
 
-  // Assume it's just a normal file
+  // Assume it's just a normal file.
+  // Check the known extensions before asking the tag reader, so resolving a whole directory
+  // doesn't run a TagLib probe per file that a suffix match already answers.
   if (!Song::kRejectedExtensions.contains(fileinfo.suffix(), Qt::CaseInsensitive) &&
-      (tagreader_client_->IsMediaFileBlocking(filename) ||
-       Song::kAcceptedExtensions.contains(fileinfo.suffix(), Qt::CaseInsensitive))) {
+      (Song::kAcceptedExtensions.contains(fileinfo.suffix(), Qt::CaseInsensitive) ||
+       tagreader_client_->IsMediaFileBlocking(filename))) {
     Song song(Song::Source::LocalFile);
     song.InitFromFilePartial(filename, fileinfo);
     if (song.is_valid()) {
@@ -181,7 +184,7 @@ SongLoader::Result SongLoader::LoadAudioCD() {
   CddaSongLoader *cdda_song_loader = new CddaSongLoader(QUrl(), this);
   QObject::connect(cdda_song_loader, &CddaSongLoader::SongsDurationLoaded, this, &SongLoader::AudioCDTracksLoadFinishedSlot);
   QObject::connect(cdda_song_loader, &CddaSongLoader::SongsMetadataLoaded, this, &SongLoader::AudioCDTracksTagsLoaded);
-  cdda_song_loader->LoadSongs();
+  cdda_song_loader->LoadSongsAsync();
   return Result::Success;
 #else
   errors_ << tr("Missing CDDA playback.");
@@ -214,6 +217,15 @@ SongLoader::Result SongLoader::LoadLocal(const QString &filename) {
 
   qLog(Debug) << "Loading local file" << filename;
 
+  // Both the collection lookup and any directory enumeration happen asynchronously,
+  // so dropping a large selection never blocks the UI thread on the database or the filesystem.
+  preload_func_ = std::bind(&SongLoader::LoadLocalAsync, this, filename);
+  return Result::BlockingLoadRequired;
+
+}
+
+SongLoader::Result SongLoader::LoadLocalAsync(const QString &filename) {
+
   // Search in the database.
   const QUrl url = QUrl::fromLocalFile(filename);
 
@@ -223,7 +235,9 @@ SongLoader::Result SongLoader::LoadLocal(const QString &filename) {
     return Result::Success;
   }
 
-  const QString canonical_filepath = QFileInfo(filename).canonicalFilePath();
+  QFileInfo fileinfo(filename);
+
+  const QString canonical_filepath = fileinfo.canonicalFilePath();
   if (!canonical_filepath.isEmpty() && canonical_filepath != filename) {
     const QUrl canonical_filepath_url = QUrl::fromLocalFile(canonical_filepath);
     songs = collection_backend_->GetSongsByUrl(canonical_filepath_url);
@@ -233,16 +247,6 @@ SongLoader::Result SongLoader::LoadLocal(const QString &filename) {
     }
   }
 
-  // It's not in the database, load it asynchronously.
-  preload_func_ = std::bind(&SongLoader::LoadLocalAsync, this, filename);
-  return Result::BlockingLoadRequired;
-
-}
-
-SongLoader::Result SongLoader::LoadLocalAsync(const QString &filename) {
-
-  QFileInfo fileinfo(filename);
-
   if (!fileinfo.exists()) {
     errors_ << tr("File %1 does not exist.").arg(filename);
     return Result::Error;
@@ -319,6 +323,43 @@ void SongLoader::LoadMetadataBlocking() {
 
 }
 
+QStringList SongLoader::ResolveFromCollection() {
+
+  QStringList filenames;
+  for (int i = 0; i < songs_.size(); i++) {
+    Song &song = songs_[i];
+    if (!song.url().isLocalFile()) continue;
+    if (song.init_from_file() && song.filetype() != Song::FileType::Unknown) continue;
+    const Song collection_song = collection_backend_->GetSongByUrl(song.url());
+    if (collection_song.is_valid()) {
+      song = collection_song;
+    }
+    else {
+      filenames << song.url().toLocalFile();
+    }
+  }
+
+  return filenames;
+
+}
+
+void SongLoader::LoadMetadataFrom(const QHash<QString, Song> &songs_by_filename) {
+
+  for (int i = 0; i < songs_.size(); i++) {
+    Song &song = songs_[i];
+    if (!song.url().isLocalFile()) continue;
+    if (song.init_from_file() && song.filetype() != Song::FileType::Unknown) continue;
+    const QString filename = song.url().toLocalFile();
+    if (songs_by_filename.contains(filename)) {
+      song = songs_by_filename.value(filename);
+    }
+    else {
+      qLog(Error) << "Could not read file" << song.url();
+    }
+  }
+
+}
+
 void SongLoader::EffectiveSongLoad(Song *song) {
 
   if (!song || !song->url().isLocalFile()) return;
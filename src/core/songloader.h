@@ -34,6 +34,7 @@
 #include <QThreadPool>
 #include <QByteArray>
 #include <QSet>
+#include <QHash>
 #include <QString>
 #include <QStringList>
 #include <QUrl>
@@ -84,6 +85,11 @@ class SongLoader : public QObject {
   // Completely load songs previously loaded with LoadFilenamesBlocking().
   // When finished, the Song objects in songs() contain metadata now. This method is blocking, do not call it from the UI thread.
   void LoadMetadataBlocking();
+  // Alternative to LoadMetadataBlocking() for callers batching tag reads across several loaders:
+  // ResolveFromCollection() fills in songs known to the collection and returns the filenames that still need a tag read,
+  // LoadMetadataFrom() then fills in the remaining songs from the caller's read results. Both are blocking.
+  QStringList ResolveFromCollection();
+  void LoadMetadataFrom(const QHash<QString, Song> &songs_by_filename);
   Result LoadAudioCD();
 
   QStringList errors() { return errors_; }
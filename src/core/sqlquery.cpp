@@ -20,7 +20,13 @@
 #include "config.h"
 
 #include <QMap>
+#include <QPair>
 #include <QVariant>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QElapsedTimer>
+
+#include "core/logging.h"
 #include <QString>
 #include <QUrl>
 
@@ -90,8 +96,47 @@ void SqlQuery::BindNotNullIntValue(const QString &placeholder, const int value)
 
 }
 
+namespace {
+
+// Set STRAWBERRY_SQL_PROFILE to a threshold in milliseconds (or to 0 for everything) to log slow queries
+// with their execution time, and per-statement totals on exit.
+qint64 SqlProfileThresholdMsec() {
+
+  static const qint64 threshold = []() {
+    const QByteArray value = qgetenv("STRAWBERRY_SQL_PROFILE");
+    if (value.isEmpty()) return Q_INT64_C(-1);
+    bool ok = false;
+    const qint64 msec = value.toLongLong(&ok);
+    return ok ? msec : Q_INT64_C(10);
+  }();
+
+  return threshold;
+
+}
+
+struct SqlProfileTotals {
+
+  ~SqlProfileTotals() {
+    QMutexLocker l(&mutex);
+    for (QMap<QString, QPair<qint64, qint64>>::const_iterator it = totals.constBegin(); it != totals.constEnd(); ++it) {
+      qLog(Debug) << "SQL profile:" << it.value().first << "executions," << it.value().second << "ms total for" << it.key().left(120);
+    }
+  }
+
+  QMutex mutex;
+  QMap<QString, QPair<qint64, qint64>> totals;  // statement -> (count, total msec)
+
+};
+
+}  // namespace
+
 bool SqlQuery::Exec() {
 
+  const qint64 profile_threshold_msec = SqlProfileThresholdMsec();
+
+  QElapsedTimer timer;
+  if (profile_threshold_msec >= 0) timer.start();
+
   bool success = exec();
   last_query_ = executedQuery();
 
@@ -100,6 +145,20 @@ bool SqlQuery::Exec() {
   }
   bound_values_.clear();
 
+  if (profile_threshold_msec >= 0) {
+    static SqlProfileTotals profile_totals;
+    const qint64 elapsed_msec = timer.elapsed();
+    {
+      QMutexLocker l(&profile_totals.mutex);
+      QPair<qint64, qint64> &entry = profile_totals.totals[lastQuery()];
+      ++entry.first;
+      entry.second += elapsed_msec;
+    }
+    if (elapsed_msec >= profile_threshold_msec) {
+      qLog(Debug) << "Slow SQL query took" << elapsed_msec << "ms:" << last_query_.left(200);
+    }
+  }
+
   return success;
 
 }
@@ -36,7 +36,8 @@
 StandardItemIconLoader::StandardItemIconLoader(AlbumCoverLoader *cover_loader, QObject *parent)
     : QObject(parent),
       cover_loader_(cover_loader),
-      model_(nullptr) {
+      model_(nullptr),
+      icon_cache_(500) {
 
   QObject::connect(cover_loader_, &AlbumCoverLoader::AlbumCoverLoaded, this, &StandardItemIconLoader::AlbumCoverLoaded);
 
@@ -57,30 +58,62 @@ void StandardItemIconLoader::SetModel(QAbstractItemModel *model) {
 
 void StandardItemIconLoader::LoadIcon(const QUrl &art_automatic, const QUrl &art_manual, QStandardItem *for_item) {
 
-  AlbumCoverLoaderOptions cover_options(AlbumCoverLoaderOptions::Option::ScaledImage);
-  cover_options.desired_scaled_size = QSize(16, 16);
-  const quint64 id = cover_loader_->LoadImageAsync(cover_options, false, art_automatic, art_manual, false);
-  pending_covers_.insert(id, for_item);
+  const QString cover_key = art_automatic.toString() + QLatin1Char('|') + art_manual.toString();
+  LoadIconForKey(cover_key, [this, art_automatic, art_manual]() {
+    AlbumCoverLoaderOptions cover_options(AlbumCoverLoaderOptions::Option::ScaledImage);
+    cover_options.desired_scaled_size = QSize(16, 16);
+    return cover_loader_->LoadImageAsync(cover_options, false, art_automatic, art_manual, false);
+  }, for_item);
 
 }
 
 void StandardItemIconLoader::LoadIcon(const Song &song, QStandardItem *for_item) {
 
-  AlbumCoverLoaderOptions cover_options(AlbumCoverLoaderOptions::Option::ScaledImage);
-  cover_options.desired_scaled_size = QSize(16, 16);
-  const quint64 id = cover_loader_->LoadImageAsync(cover_options, song);
-  pending_covers_.insert(id, for_item);
+  const QString cover_key = (song.art_embedded() ? song.url().toString() : QString()) + QLatin1Char('|') + song.art_automatic().toString() + QLatin1Char('|') + song.art_manual().toString();
+  LoadIconForKey(cover_key, [this, song]() {
+    AlbumCoverLoaderOptions cover_options(AlbumCoverLoaderOptions::Option::ScaledImage);
+    cover_options.desired_scaled_size = QSize(16, 16);
+    return cover_loader_->LoadImageAsync(cover_options, song);
+  }, for_item);
 
 }
 
-void StandardItemIconLoader::RowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end) {
+void StandardItemIconLoader::LoadIconForKey(const QString &cover_key, const std::function<quint64()> &start_load, QStandardItem *for_item) {
+
+  if (const QIcon *cached_icon = icon_cache_.object(cover_key)) {
+    for_item->setIcon(*cached_icon);
+    return;
+  }
 
-  for (QMap<quint64, QStandardItem*>::iterator it = pending_covers_.begin(); it != pending_covers_.end();) {
-    const QStandardItem *item = it.value();
-    const QStandardItem *item_parent = item->parent();
+  if (pending_ids_by_key_.contains(cover_key)) {
+    pending_covers_[pending_ids_by_key_.value(cover_key)] << for_item;
+    return;
+  }
+
+  const quint64 id = start_load();
+  pending_covers_[id] << for_item;
+  pending_keys_.insert(id, cover_key);
+  pending_ids_by_key_.insert(cover_key, id);
 
-    if (item_parent && item_parent->index() == parent && item->index().row() >= begin && item->index().row() <= end) {
+}
+
+void StandardItemIconLoader::RowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end) {
+
+  for (QMap<quint64, QList<QStandardItem*>>::iterator it = pending_covers_.begin(); it != pending_covers_.end();) {
+    QList<QStandardItem*> &items = it.value();
+    for (QList<QStandardItem*>::iterator item_it = items.begin(); item_it != items.end();) {
+      const QStandardItem *item = *item_it;
+      const QStandardItem *item_parent = item->parent();
+      if (item_parent && item_parent->index() == parent && item->index().row() >= begin && item->index().row() <= end) {
+        item_it = items.erase(item_it);
+      }
+      else {
+        ++item_it;
+      }
+    }
+    if (items.isEmpty()) {
       cover_loader_->CancelTask(it.key());
+      pending_ids_by_key_.remove(pending_keys_.take(it.key()));
       it = pending_covers_.erase(it);
     }
     else {
@@ -94,6 +127,8 @@ void StandardItemIconLoader::ModelReset() {
 
   cover_loader_->CancelTasks(QSet<quint64>(pending_covers_.keyBegin(), pending_covers_.keyEnd()));
   pending_covers_.clear();
+  pending_keys_.clear();
+  pending_ids_by_key_.clear();
 
 }
 
@@ -101,11 +136,16 @@ void StandardItemIconLoader::AlbumCoverLoaded(const quint64 id, const AlbumCover
 
   if (!pending_covers_.contains(id)) return;
 
-  QStandardItem *item = pending_covers_.take(id);
-  if (!item) return;
+  const QList<QStandardItem*> items = pending_covers_.take(id);
+  const QString cover_key = pending_keys_.take(id);
+  pending_ids_by_key_.remove(cover_key);
 
   if (result.success && !result.image_scaled.isNull() && result.type != AlbumCoverLoaderResult::Type::Unset) {
-    item->setIcon(QIcon(QPixmap::fromImage(result.image_scaled)));
+    const QIcon icon(QPixmap::fromImage(result.image_scaled));
+    for (QStandardItem *item : items) {
+      if (item) item->setIcon(icon);
+    }
+    icon_cache_.insert(cover_key, new QIcon(icon));
   }
 
 }
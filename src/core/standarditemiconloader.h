@@ -23,10 +23,16 @@
 
 #include "config.h"
 
+#include <functional>
+
 #include <QtGlobal>
 #include <QObject>
+#include <QCache>
+#include <QList>
 #include <QMap>
+#include <QString>
 #include <QUrl>
+#include <QIcon>
 #include <QImage>
 
 #include "covermanager/albumcoverloaderresult.h"
@@ -49,6 +55,9 @@ class StandardItemIconLoader : public QObject {
   void LoadIcon(const QUrl &art_automatic, const QUrl &art_manual, QStandardItem *for_item);
   void LoadIcon(const Song &song, QStandardItem *for_item);
 
+ private:
+  void LoadIconForKey(const QString &cover_key, const std::function<quint64()> &start_load, QStandardItem *for_item);
+
  private Q_SLOTS:
   void AlbumCoverLoaded(const quint64 id, const AlbumCoverLoaderResult &result);
   void RowsAboutToBeRemoved(const QModelIndex &parent, int begin, int end);
@@ -57,7 +66,12 @@ class StandardItemIconLoader : public QObject {
  private:
   AlbumCoverLoader *cover_loader_;
   QAbstractItemModel *model_;
-  QMap<quint64, QStandardItem*> pending_covers_;
+  // Items that share the same art are resolved by one load, and resolved icons are cached so
+  // re-filling a list with many rows of the same album doesn't load the cover per row.
+  QMap<quint64, QList<QStandardItem*>> pending_covers_;
+  QMap<quint64, QString> pending_keys_;
+  QMap<QString, quint64> pending_ids_by_key_;
+  QCache<QString, QIcon> icon_cache_;
 };
 
 #endif  // STANDARDITEMICONLOADER_H
@@ -28,23 +28,26 @@
 #include <QList>
 #include <QString>
 
+#include <QDateTime>
+
 #include "taskmanager.h"
 
 using namespace Qt::Literals::StringLiterals;
 
-TaskManager::TaskManager(QObject *parent) : QObject(parent), next_task_id_(1) {
+TaskManager::TaskManager(QObject *parent) : QObject(parent), next_task_id_(1), last_progress_emit_msec_(0) {
 
   setObjectName(QLatin1String(metaObject()->className()));
 
 }
 
-int TaskManager::StartTask(const QString &name) {
+int TaskManager::StartTask(const QString &name, const Priority priority) {
 
   Task t;
   t.name = name;
   t.progress = 0;
   t.progress_max = 0;
   t.blocks_collection_scans = false;
+  t.priority = priority;
 
   {
     QMutexLocker l(&mutex_);
@@ -66,6 +69,9 @@ QList<TaskManager::Task> TaskManager::GetTasks() {
     ret = tasks_.values();
   }
 
+  // Show the most important work first.
+  std::stable_sort(ret.begin(), ret.end(), [](const Task &a, const Task &b) { return static_cast<int>(a.priority) > static_cast<int>(b.priority); });
+
   return ret;
 
 }
@@ -77,6 +83,7 @@ void TaskManager::SetTaskBlocksCollectionScans(const int id) {
     if (!tasks_.contains(id)) return;
 
     tasks_[id].blocks_collection_scans = true;
+    tasks_[id].priority = Priority::High;
   }
 
   Q_EMIT TasksChanged();
@@ -86,6 +93,8 @@ void TaskManager::SetTaskBlocksCollectionScans(const int id) {
 
 void TaskManager::SetTaskProgress(const int id, const quint64 progress, const quint64 max) {
 
+  const qint64 now = QDateTime::currentMSecsSinceEpoch();
+
   {
     QMutexLocker l(&mutex_);
     if (!tasks_.contains(id)) return;
@@ -94,6 +103,9 @@ void TaskManager::SetTaskProgress(const int id, const quint64 progress, const qu
     t.progress = progress;
     if (max > 0) t.progress_max = max;
     tasks_[id] = t;
+
+    if (now - last_progress_emit_msec_ < 100) return;
+    last_progress_emit_msec_ = now;
   }
 
   Q_EMIT TasksChanged();
@@ -101,6 +113,8 @@ void TaskManager::SetTaskProgress(const int id, const quint64 progress, const qu
 
 void TaskManager::IncreaseTaskProgress(const int id, const quint64 progress, const quint64 max) {
 
+  const qint64 now = QDateTime::currentMSecsSinceEpoch();
+
   {
     QMutexLocker l(&mutex_);
     if (!tasks_.contains(id)) return;
@@ -109,6 +123,9 @@ void TaskManager::IncreaseTaskProgress(const int id, const quint64 progress, con
     t.progress += progress;
     if (max > 0) t.progress_max = max;
     tasks_[id] = t;
+
+    if (now - last_progress_emit_msec_ < 100) return;
+    last_progress_emit_msec_ = now;
   }
 
   Q_EMIT TasksChanged();
@@ -37,13 +37,22 @@ class TaskManager : public QObject {
  public:
   explicit TaskManager(QObject *parent = nullptr);
 
+  // User-initiated work (organizing, transcoding) outranks background maintenance like collection scans,
+  // both in the task display and in which tasks may pause the watchers.
+  enum class Priority {
+    Low = 0,
+    Normal,
+    High
+  };
+
   struct Task {
-    Task() : id(0), progress(0), progress_max(0), blocks_collection_scans(false) {}
+    Task() : id(0), progress(0), progress_max(0), blocks_collection_scans(false), priority(Priority::Normal) {}
     int id;
     QString name;
     quint64 progress;
     quint64 progress_max;
     bool blocks_collection_scans;
+    Priority priority;
   };
 
   class ScopedTask {
@@ -62,7 +71,7 @@ class TaskManager : public QObject {
   // Everything here is thread safe
   QList<Task> GetTasks();
 
-  int StartTask(const QString &name);
+  int StartTask(const QString &name, const Priority priority = Priority::Normal);
   void SetTaskBlocksCollectionScans(const int id);
   void SetTaskProgress(const int id, const quint64 progress, const quint64 max = 0);
   void IncreaseTaskProgress(const int id, const quint64 progress, const quint64 max = 0);
@@ -79,6 +88,9 @@ class TaskManager : public QObject {
   QMutex mutex_;
   QMap<int, Task> tasks_;
   int next_task_id_;
+  // Progress updates arrive per file during scans; TasksChanged for pure progress is rate limited,
+  // task start and finish still notify immediately.
+  qint64 last_progress_emit_msec_;
 
   Q_DISABLE_COPY(TaskManager)
 };
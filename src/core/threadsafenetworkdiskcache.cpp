@@ -27,6 +27,7 @@
 #include <QStandardPaths>
 #include <QIODevice>
 #include <QMutex>
+#include <QHash>
 #include <QNetworkDiskCache>
 #include <QNetworkCacheMetaData>
 #include <QAbstractNetworkCache>
@@ -36,74 +37,118 @@
 
 using namespace Qt::Literals::StringLiterals;
 
-QMutex ThreadSafeNetworkDiskCache::sMutex;
+QMutex ThreadSafeNetworkDiskCache::sInstancesMutex;
 int ThreadSafeNetworkDiskCache::sInstances = 0;
-QNetworkDiskCache *ThreadSafeNetworkDiskCache::sCache = nullptr;
+QMutex ThreadSafeNetworkDiskCache::sMutexes[ThreadSafeNetworkDiskCache::kShards];
+QNetworkDiskCache *ThreadSafeNetworkDiskCache::sCaches[ThreadSafeNetworkDiskCache::kShards] = {};
+QMutex ThreadSafeNetworkDiskCache::sDeviceShardsMutex;
+QHash<QIODevice*, int> ThreadSafeNetworkDiskCache::sDeviceShards;
 
 ThreadSafeNetworkDiskCache::ThreadSafeNetworkDiskCache(QObject *parent) : QAbstractNetworkCache(parent) {
 
-  QMutexLocker l(&sMutex);
+  QMutexLocker l(&sInstancesMutex);
   ++sInstances;
 
-  if (!sCache) {
-    sCache = new QNetworkDiskCache;
+  if (!sCaches[0]) {
 #ifdef Q_OS_WIN32
-    sCache->setCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::TempLocation) + u"/strawberry/networkcache"_s);
+    const QString cache_directory = QStandardPaths::writableLocation(QStandardPaths::TempLocation) + u"/strawberry/networkcache"_s;
 #else
-    sCache->setCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + u"/networkcache"_s);
+    const QString cache_directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + u"/networkcache"_s;
 #endif
+    for (int i = 0; i < kShards; ++i) {
+      sCaches[i] = new QNetworkDiskCache;
+      sCaches[i]->setCacheDirectory(cache_directory + QStringLiteral("/shard-%1").arg(i));
+    }
   }
 
 }
 
 ThreadSafeNetworkDiskCache::~ThreadSafeNetworkDiskCache() {
 
-  QMutexLocker l(&sMutex);
+  QMutexLocker l(&sInstancesMutex);
   --sInstances;
 
-  if (sCache && sInstances == 0) {
-    sCache->deleteLater();
-    sCache = nullptr;
+  if (sCaches[0] && sInstances == 0) {
+    for (int i = 0; i < kShards; ++i) {
+      sCaches[i]->deleteLater();
+      sCaches[i] = nullptr;
+    }
   }
 
 }
 
+int ThreadSafeNetworkDiskCache::ShardForUrl(const QUrl &url) {
+  return static_cast<int>(qHash(url.toString()) % static_cast<size_t>(kShards));
+}
+
 qint64 ThreadSafeNetworkDiskCache::cacheSize() const {
-  QMutexLocker l(&sMutex);
-  return sCache->cacheSize();
+
+  qint64 size = 0;
+  for (int i = 0; i < kShards; ++i) {
+    QMutexLocker l(&sMutexes[i]);
+    size += sCaches[i]->cacheSize();
+  }
+  return size;
+
 }
 
 QIODevice *ThreadSafeNetworkDiskCache::data(const QUrl &url) {
-  QMutexLocker l(&sMutex);
-  return sCache->data(url);
+  const int shard = ShardForUrl(url);
+  QMutexLocker l(&sMutexes[shard]);
+  return sCaches[shard]->data(url);
 }
 
 void ThreadSafeNetworkDiskCache::insert(QIODevice *device) {
-  QMutexLocker l(&sMutex);
-  sCache->insert(device);
+
+  int shard = -1;
+  {
+    QMutexLocker l(&sDeviceShardsMutex);
+    shard = sDeviceShards.take(device);
+  }
+  QMutexLocker l(&sMutexes[shard]);
+  sCaches[shard]->insert(device);
+
 }
 
 QNetworkCacheMetaData ThreadSafeNetworkDiskCache::metaData(const QUrl &url) {
-  QMutexLocker l(&sMutex);
-  return sCache->metaData(url);
+  const int shard = ShardForUrl(url);
+  QMutexLocker l(&sMutexes[shard]);
+  return sCaches[shard]->metaData(url);
 }
 
 QIODevice *ThreadSafeNetworkDiskCache::prepare(const QNetworkCacheMetaData &metaData) {
-  QMutexLocker l(&sMutex);
-  return sCache->prepare(metaData);
+
+  const int shard = ShardForUrl(metaData.url());
+  QIODevice *device = nullptr;
+  {
+    QMutexLocker l(&sMutexes[shard]);
+    device = sCaches[shard]->prepare(metaData);
+  }
+  if (device) {
+    QMutexLocker l(&sDeviceShardsMutex);
+    sDeviceShards.insert(device, shard);
+  }
+  return device;
+
 }
 
 bool ThreadSafeNetworkDiskCache::remove(const QUrl &url) {
-  QMutexLocker l(&sMutex);
-  return sCache->remove(url);
+  const int shard = ShardForUrl(url);
+  QMutexLocker l(&sMutexes[shard]);
+  return sCaches[shard]->remove(url);
 }
 
 void ThreadSafeNetworkDiskCache::updateMetaData(const QNetworkCacheMetaData &metaData) {
-  QMutexLocker l(&sMutex);
-  sCache->updateMetaData(metaData);
+  const int shard = ShardForUrl(metaData.url());
+  QMutexLocker l(&sMutexes[shard]);
+  sCaches[shard]->updateMetaData(metaData);
 }
 
 void ThreadSafeNetworkDiskCache::clear() {
-  QMutexLocker l(&sMutex);
-  sCache->clear();
+
+  for (int i = 0; i < kShards; ++i) {
+    QMutexLocker l(&sMutexes[i]);
+    sCaches[i]->clear();
+  }
+
 }
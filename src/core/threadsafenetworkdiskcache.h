@@ -28,12 +28,15 @@
 #include <QObject>
 #include <QAbstractNetworkCache>
 #include <QMutex>
+#include <QHash>
 #include <QUrl>
 #include <QNetworkCacheMetaData>
 
 class QIODevice;
 class QNetworkDiskCache;
 
+// The cache is split into independently locked shards selected by URL hash,
+// so cache traffic from one thread doesn't serialize every other thread behind a single lock.
 class ThreadSafeNetworkDiskCache : public QAbstractNetworkCache {
   Q_OBJECT
 
@@ -53,9 +56,17 @@ class ThreadSafeNetworkDiskCache : public QAbstractNetworkCache {
   void clear() override;
 
  private:
-  static QMutex sMutex;
+  static int ShardForUrl(const QUrl &url);
+
+  static constexpr int kShards = 4;
+
+  static QMutex sInstancesMutex;
   static int sInstances;
-  static QNetworkDiskCache *sCache;
+  static QMutex sMutexes[kShards];
+  static QNetworkDiskCache *sCaches[kShards];
+  // Maps devices handed out by prepare() back to the shard that created them.
+  static QMutex sDeviceShardsMutex;
+  static QHash<QIODevice*, int> sDeviceShards;
 };
 
 #endif  // THREADSAFENETWORKDISKCACHE_H
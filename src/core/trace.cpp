@@ -0,0 +1,197 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "config.h"
+
+#include <cstdio>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <utility>
+
+#include <QtGlobal>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QByteArray>
+#include <QList>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QElapsedTimer>
+
+#include "trace.h"
+
+namespace Tracing {
+
+namespace {
+
+QMutex sMutex;
+FILE *sFile = nullptr;
+bool sInitialized = false;
+QElapsedTimer sTimer;
+
+FILE *TraceFile() {
+
+  if (!sInitialized) {
+    sInitialized = true;
+    const QByteArray filename = qgetenv("STRAWBERRY_TRACE_FILE");
+    if (!filename.isEmpty()) {
+      sFile = fopen(filename.constData(), "w");
+      if (sFile) {
+        // The trace viewers accept a JSON array that is never closed.
+        fputs("[\n", sFile);
+        sTimer.start();
+      }
+    }
+  }
+
+  return sFile;
+
+}
+
+}  // namespace
+
+bool Enabled() {
+
+  QMutexLocker l(&sMutex);
+  return TraceFile() != nullptr;
+
+}
+
+qint64 NowUsec() {
+
+  QMutexLocker l(&sMutex);
+  if (!TraceFile()) return 0;
+  return sTimer.nsecsElapsed() / 1000;
+
+}
+
+void RecordEvent(const char *name, const qint64 timestamp_usec, const qint64 duration_usec) {
+
+  QMutexLocker l(&sMutex);
+  FILE *file = TraceFile();
+  if (!file) return;
+
+  fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%llu},\n",
+          name,
+          static_cast<long long>(timestamp_usec),
+          static_cast<long long>(duration_usec),
+          static_cast<unsigned long long>(reinterpret_cast<quintptr>(QThread::currentThreadId())));
+
+}
+
+namespace {
+
+struct ThreadScopeSlot {
+  std::atomic<const char*> scope{nullptr};
+};
+
+QMutex sSlotsMutex;
+QList<ThreadScopeSlot*> sSlots;
+std::atomic<bool> sSamplerStop{false};
+std::thread *sSamplerThread = nullptr;
+
+ThreadScopeSlot *CurrentThreadSlot() {
+
+  thread_local ThreadScopeSlot *slot = []() {
+    ThreadScopeSlot *new_slot = new ThreadScopeSlot;
+    QMutexLocker l(&sSlotsMutex);
+    sSlots << new_slot;
+    return new_slot;
+  }();
+  return slot;
+
+}
+
+struct SamplerResults {
+
+  ~SamplerResults() {
+    QMutexLocker l(&mutex);
+    quint64 total = 0;
+    for (QHash<QString, quint64>::const_iterator it = counts.constBegin(); it != counts.constEnd(); ++it) {
+      total += it.value();
+    }
+    for (QHash<QString, quint64>::const_iterator it = counts.constBegin(); it != counts.constEnd(); ++it) {
+      fprintf(stderr, "Profile: %6.2f%% (%llu samples) %s\n", total > 0 ? 100.0 * static_cast<double>(it.value()) / static_cast<double>(total) : 0.0, static_cast<unsigned long long>(it.value()), it.key().toUtf8().constData());
+    }
+  }
+
+  QMutex mutex;
+  QHash<QString, quint64> counts;
+
+};
+
+SamplerResults &Results() {
+  static SamplerResults results;
+  return results;
+}
+
+void SamplerLoop() {
+
+  while (!sSamplerStop.load(std::memory_order_relaxed)) {
+    {
+      QMutexLocker slots_lock(&sSlotsMutex);
+      QMutexLocker results_lock(&Results().mutex);
+      for (ThreadScopeSlot *slot : std::as_const(sSlots)) {
+        const char *scope = slot->scope.load(std::memory_order_relaxed);
+        if (scope) {
+          ++Results().counts[QString::fromLatin1(scope)];
+        }
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(9));
+  }
+
+}
+
+}  // namespace
+
+bool SamplingEnabled() {
+
+  static const bool enabled = []() {
+    if (qEnvironmentVariableIsEmpty("STRAWBERRY_PROFILE")) return false;
+    Results();  // Constructed before the sampler so it outlives it and prints at exit.
+    sSamplerThread = new std::thread(SamplerLoop);
+    std::atexit([]() {
+      sSamplerStop.store(true, std::memory_order_relaxed);
+      if (sSamplerThread && sSamplerThread->joinable()) sSamplerThread->join();
+    });
+    return true;
+  }();
+
+  return enabled;
+
+}
+
+void EnterScope(const char *name, const char **previous) {
+
+  ThreadScopeSlot *slot = CurrentThreadSlot();
+  *previous = slot->scope.load(std::memory_order_relaxed);
+  slot->scope.store(name, std::memory_order_relaxed);
+
+}
+
+void LeaveScope(const char *previous) {
+
+  CurrentThreadSlot()->scope.store(previous, std::memory_order_relaxed);
+
+}
+
+}  // namespace Tracing
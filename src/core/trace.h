@@ -0,0 +1,79 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "config.h"
+
+#include <QtGlobal>
+#include <QString>
+#include <QElapsedTimer>
+
+// Lightweight tracing in the Chrome trace event format, viewable in chrome://tracing or Perfetto.
+// Disabled unless the STRAWBERRY_TRACE_FILE environment variable names an output file,
+// in which case scopes cost one clock read on entry and one buffered write on exit.
+
+namespace Tracing {
+
+bool Enabled();
+void RecordEvent(const char *name, const qint64 timestamp_usec, const qint64 duration_usec);
+qint64 NowUsec();
+
+// Sampled self-profiler, enabled with STRAWBERRY_PROFILE=1: a sampler thread periodically records which
+// traced scope each thread is in and prints per-subsystem sample counts at exit.
+// When enabled, entering a scope costs one relaxed atomic store.
+bool SamplingEnabled();
+void EnterScope(const char *name, const char **previous);
+void LeaveScope(const char *previous);
+
+class ScopedTrace {
+ public:
+  explicit ScopedTrace(const char *name) : name_(nullptr), sampled_(false), previous_scope_(nullptr) {
+    if (Enabled()) {
+      name_ = name;
+      start_usec_ = NowUsec();
+    }
+    if (SamplingEnabled()) {
+      sampled_ = true;
+      EnterScope(name, &previous_scope_);
+    }
+  }
+  ~ScopedTrace() {
+    if (name_) {
+      const qint64 now_usec = NowUsec();
+      RecordEvent(name_, start_usec_, now_usec - start_usec_);
+    }
+    if (sampled_) {
+      LeaveScope(previous_scope_);
+    }
+  }
+
+ private:
+  const char *name_;
+  qint64 start_usec_;
+  bool sampled_;
+  const char *previous_scope_;
+
+  Q_DISABLE_COPY(ScopedTrace)
+};
+
+}  // namespace Tracing
+
+#endif  // TRACE_H
@@ -24,6 +24,8 @@
 #include <QUrl>
 
 #include "song.h"
+#include <QDateTime>
+
 #include "urlhandler.h"
 
 UrlHandler::UrlHandler(QObject *parent) : QObject(parent) {}
@@ -46,3 +48,27 @@ UrlHandler::LoadResult::LoadResult(const QUrl &media_url, const Type type, const
   length_nanosec_(-1),
   error_(error)
   {}
+
+std::optional<UrlHandler::LoadResult> UrlHandler::GetCachedStreamURL(const QUrl &url) {
+
+  const QHash<QUrl, CachedStreamURL>::const_iterator it = stream_url_cache_.constFind(url);
+  if (it == stream_url_cache_.constEnd()) return std::nullopt;
+  if (QDateTime::currentSecsSinceEpoch() >= it->expiry) {
+    stream_url_cache_.erase(it);
+    return std::nullopt;
+  }
+
+  return it->result;
+
+}
+
+void UrlHandler::CacheStreamURL(const LoadResult &result, const qint64 ttl_secs) {
+
+  if (result.type_ != LoadResult::Type::TrackAvailable) return;
+
+  CachedStreamURL cached;
+  cached.expiry = QDateTime::currentSecsSinceEpoch() + ttl_secs;
+  cached.result = result;
+  stream_url_cache_.insert(result.media_url_, cached);
+
+}
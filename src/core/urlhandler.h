@@ -22,8 +22,11 @@
 
 #include "config.h"
 
+#include <optional>
+
 #include <QtGlobal>
 #include <QObject>
+#include <QHash>
 #include <QString>
 #include <QUrl>
 
@@ -88,6 +91,21 @@ class UrlHandler : public QObject {
   // Called by the Player when a song starts loading - gives the handler a chance to do something clever to get a playable track.
   virtual LoadResult StartLoading(const QUrl &url) { return LoadResult(url); }
 
+ protected:
+  // Resolved stream URLs stay valid for a while; serving repeats from this cache skips an API round trip
+  // when the same track is loaded again shortly, for example when flipping back or pre-resolving a transition.
+  std::optional<LoadResult> GetCachedStreamURL(const QUrl &url);
+  void CacheStreamURL(const LoadResult &result, const qint64 ttl_secs = 600);
+
+ private:
+  struct CachedStreamURL {
+    qint64 expiry;
+    LoadResult result;
+  };
+  QHash<QUrl, CachedStreamURL> stream_url_cache_;
+
+ public:
+
  Q_SIGNALS:
   void AsyncLoadComplete(const UrlHandler::LoadResult &result);
 
@@ -34,6 +34,7 @@
 #include <QDialog>
 #include <QDir>
 #include <QFile>
+#include <QSaveFile>
 #include <QFileInfo>
 #include <QMimeData>
 #include <QSet>
@@ -680,25 +681,25 @@ QUrl AlbumCoverChoiceController::SaveCoverToFileAutomatic(const Song::Source sou
     filepath = file.fileName();
   }
 
+  // Write through QSaveFile so an existing cover is replaced atomically and a crash can't leave a truncated file
+  // that the art state in the database already points to.
   if (!result.image_data.isEmpty() && result.is_jpeg()) {
-    if (file.open(QIODevice::WriteOnly)) {
-      if (file.write(result.image_data) > 0) {
-        file.close();
+    QSaveFile save_file(file.fileName());
+    if (save_file.open(QIODevice::WriteOnly)) {
+      if (save_file.write(result.image_data) > 0 && save_file.commit()) {
         return QUrl::fromLocalFile(filepath);
       }
-      else {
-        qLog(Error) << "Failed to write cover to file" << file.fileName() << file.errorString();
-        Q_EMIT Error(tr("Failed to write cover to file %1: %2").arg(file.fileName(), file.errorString()));
-      }
-      file.close();
+      qLog(Error) << "Failed to write cover to file" << save_file.fileName() << save_file.errorString();
+      Q_EMIT Error(tr("Failed to write cover to file %1: %2").arg(save_file.fileName(), save_file.errorString()));
     }
     else {
-      qLog(Error) << "Failed to open cover file" << file.fileName() << "for writing:" << file.errorString();
-      Q_EMIT Error(tr("Failed to open cover file %1 for writing: %2").arg(file.fileName(), file.errorString()));
+      qLog(Error) << "Failed to open cover file" << save_file.fileName() << "for writing:" << save_file.errorString();
+      Q_EMIT Error(tr("Failed to open cover file %1 for writing: %2").arg(save_file.fileName(), save_file.errorString()));
     }
   }
   else {
-    if (result.image.save(filepath, "JPG")) {
+    QSaveFile save_file(filepath);
+    if (save_file.open(QIODevice::WriteOnly) && result.image.save(&save_file, "JPG") && save_file.commit()) {
       return QUrl::fromLocalFile(filepath);
     }
   }
@@ -21,6 +21,7 @@
 #include "config.h"
 
 #include <QObject>
+#include <QThread>
 #include <QThreadPool>
 
 #include "core/song.h"
@@ -30,7 +31,7 @@
 #include "coverexportrunnable.h"
 
 namespace {
-constexpr int kMaxConcurrentRequests = 3;
+constexpr int kMinConcurrentRequests = 3;
 }
 
 AlbumCoverExporter::AlbumCoverExporter(const SharedPtr<TagReaderClient> tagreader_client, QObject *parent)
@@ -40,7 +41,8 @@ AlbumCoverExporter::AlbumCoverExporter(const SharedPtr<TagReaderClient> tagreade
       exported_(0),
       skipped_(0),
       all_(0) {
-  thread_pool_->setMaxThreadCount(kMaxConcurrentRequests);
+  // Exporting decodes, rescales and re-encodes covers, so scale the pool with the cores, leaving one free for the UI.
+  thread_pool_->setMaxThreadCount(qMax(kMinConcurrentRequests, QThread::idealThreadCount() - 1));
 }
 
 void AlbumCoverExporter::SetDialogResult(const AlbumCoverExport::DialogResult &dialog_result) {
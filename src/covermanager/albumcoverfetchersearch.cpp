@@ -28,7 +28,9 @@
 #include <QObject>
 #include <QCoreApplication>
 #include <QTimer>
+#include <QDateTime>
 #include <QList>
+#include <QMap>
 #include <QString>
 #include <QUrl>
 #include <QImage>
@@ -87,6 +89,8 @@ void AlbumCoverFetcherSearch::TerminateSearch() {
 
 void AlbumCoverFetcherSearch::Start(SharedPtr<CoverProviders> cover_providers) {
 
+  cover_providers_ = cover_providers;
+
   // Ignore Radio Paradise "commercial" break.
   if (request_.artist.compare("commercial-free"_L1, Qt::CaseInsensitive) == 0 && request_.title.compare("listener-supported"_L1, Qt::CaseInsensitive) == 0) {
     TerminateSearch();
@@ -122,6 +126,7 @@ void AlbumCoverFetcherSearch::Start(SharedPtr<CoverProviders> cover_providers) {
 
     if (success) {
       pending_requests_[id] = provider;
+      provider_search_started_[provider] = QDateTime::currentMSecsSinceEpoch();
       statistics_.network_requests_made_++;
     }
   }
@@ -148,6 +153,10 @@ void AlbumCoverFetcherSearch::ProviderSearchResults(CoverProvider *provider, con
 
     results_copy[i].provider = provider->name();
     results_copy[i].score_provider = provider->quality();
+    if (cover_providers_) {
+      // Route image loads toward providers that historically answer quickly with usable covers.
+      results_copy[i].score_provider += cover_providers_->ProviderScoreBonus(provider->name());
+    }
 
     const QString &request_artist = request_.artist;
     const QString &request_album = request_.album;
@@ -238,6 +247,11 @@ void AlbumCoverFetcherSearch::ProviderSearchFinished(const int id, const CoverPr
   CoverProvider *provider = pending_requests_.take(id);
   ProviderSearchResults(provider, results);
 
+  if (cover_providers_ && provider_search_started_.contains(provider)) {
+    const qint64 latency_msec = QDateTime::currentMSecsSinceEpoch() - provider_search_started_.take(provider);
+    cover_providers_->ReportProviderSearch(provider->name(), !results.isEmpty(), latency_msec);
+  }
+
   // Do we have more providers left?
   if (!pending_requests_.isEmpty()) {
     return;
@@ -278,10 +292,21 @@ void AlbumCoverFetcherSearch::AllProvidersFinished() {
 
 void AlbumCoverFetcherSearch::FetchMoreImages() {
 
-  int i = 0;
-  while (!results_.isEmpty()) {
-    ++i;
-    CoverProviderSearchResult result = results_.takeFirst();
+  // Load a couple of images from each provider in parallel instead of the first three results overall,
+  // so the downloads spread across hosts and each provider's kept-alive connection is reused for its second image.
+  int started = 0;
+  QMap<QString, int> provider_counts;
+  for (CoverProviderSearchResults::iterator it = results_.begin(); it != results_.end() && started < 6;) {
+
+    if (provider_counts.value(it->provider) >= 2) {
+      ++it;
+      continue;
+    }
+
+    const CoverProviderSearchResult result = *it;
+    it = results_.erase(it);
+    ++provider_counts[result.provider];
+    ++started;
 
     qLog(Debug) << "Loading" << result.artist << result.album << result.image_url << "from" << result.provider << "with current score" << result.score();
 
@@ -294,8 +319,6 @@ void AlbumCoverFetcherSearch::FetchMoreImages() {
 
     ++statistics_.network_requests_made_;
 
-    if (i >= 3) break;
-
   }
 
   if (pending_image_loads_.isEmpty()) {
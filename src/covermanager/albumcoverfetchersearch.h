@@ -99,6 +99,9 @@ class AlbumCoverFetcherSearch : public QObject {
   CoverProviderSearchResults results_;
 
   QMap<int, CoverProvider*> pending_requests_;
+  // For latency/success accounting reported back to CoverProviders.
+  SharedPtr<CoverProviders> cover_providers_;
+  QMap<CoverProvider*, qint64> provider_search_started_;
   QHash<QNetworkReply*, CoverProviderSearchResult> pending_image_loads_;
   NetworkTimeouts *image_load_timeout_;
 
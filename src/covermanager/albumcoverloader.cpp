@@ -32,10 +32,17 @@
 #include <QUrl>
 #include <QFile>
 #include <QImage>
+#include <QImageReader>
 #include <QTimer>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QNetworkDiskCache>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QBuffer>
 
+#include "includes/scoped_ptr.h"
 #include "includes/shared_ptr.h"
 #include "core/logging.h"
 #include "core/networkaccessmanager.h"
@@ -59,6 +66,7 @@ AlbumCoverLoader::AlbumCoverLoader(const SharedPtr<TagReaderClient> tagreader_cl
     : QObject(parent),
       tagreader_client_(tagreader_client),
       network_(new NetworkAccessManager(this)),
+      scaled_disk_cache_(new QNetworkDiskCache(this)),
       timer_process_tasks_(new QTimer(this)),
       stop_requested_(false),
       load_image_async_id_(1),
@@ -68,6 +76,9 @@ AlbumCoverLoader::AlbumCoverLoader(const SharedPtr<TagReaderClient> tagreader_cl
 
   original_thread_ = thread();
 
+  scaled_disk_cache_->setCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/scaled-covers"));
+  scaled_disk_cache_->setMaximumCacheSize(100LL * 1024LL * 1024LL);
+
   timer_process_tasks_->setSingleShot(false);
   timer_process_tasks_->setInterval(10ms);
   QObject::connect(timer_process_tasks_, &QTimer::timeout, this, &AlbumCoverLoader::ProcessTasks);
@@ -215,6 +226,10 @@ void AlbumCoverLoader::ProcessTask(TaskPtr task) {
     task->success = true;
   }
   else {
+    // When only a scaled image is wanted, a cached thumbnail avoids loading and rescaling the full-size cover.
+    if (task->scaled_image() && !task->original_image() && !task->raw_image_data() && LoadScaledImageFromDiskCache(task)) {
+      return;
+    }
     InitArt(task);
   }
 
@@ -245,9 +260,14 @@ void AlbumCoverLoader::FinishTask(TaskPtr task, const AlbumCoverLoaderResult::Ty
   QImage image_scaled;
   if (!task->album_cover.image_data.isEmpty() && !task->album_cover.image.isNull()) {
     task->result_type = result_type;
-    task->album_cover.mime_type = Utilities::MimeTypeFromData(task->album_cover.image_data);
+    if (task->album_cover.mime_type.isEmpty()) {
+      task->album_cover.mime_type = Utilities::MimeTypeFromData(task->album_cover.image_data);
+    }
     if (task->scaled_image()) {
       image_scaled = ImageUtils::ScaleImage(task->album_cover.image, task->options.desired_scaled_size, task->options.device_pixel_ratio, task->pad_scaled_image());
+      if (!image_scaled.isNull()) {
+        SaveScaledImageToDiskCache(task, image_scaled);
+      }
     }
     if (!task->raw_image_data() && !task->album_cover.image_data.isNull()) {
       task->album_cover.image_data = QByteArray();
@@ -261,6 +281,90 @@ void AlbumCoverLoader::FinishTask(TaskPtr task, const AlbumCoverLoaderResult::Ty
 
 }
 
+QUrl AlbumCoverLoader::ScaledCacheUrl(TaskPtr task) const {
+
+  QUrl art_url;
+  if (!task->art_unset) {
+    if (task->art_manual.isValid() && !task->art_manual.isEmpty()) {
+      art_url = task->art_manual;
+    }
+    else if (task->art_automatic.isValid() && !task->art_automatic.isEmpty()) {
+      art_url = task->art_automatic;
+    }
+    else if (task->art_embedded && task->song_url.isValid()) {
+      art_url = task->song_url;
+    }
+  }
+  if (!art_url.isValid() || art_url.isEmpty()) return QUrl();
+
+  QString key = art_url.toString(QUrl::FullyEncoded);
+  // Local art can be replaced in place, include the mtime so a changed file misses the cache.
+  if (art_url.isLocalFile()) {
+    const QFileInfo fileinfo(art_url.toLocalFile());
+    if (!fileinfo.exists()) return QUrl();
+    key += QLatin1Char('|') + QString::number(fileinfo.lastModified().toSecsSinceEpoch());
+  }
+  key += QStringLiteral("|%1x%2|%3|%4").arg(task->options.desired_scaled_size.width()).arg(task->options.desired_scaled_size.height()).arg(task->options.device_pixel_ratio).arg(task->pad_scaled_image() ? 1 : 0);
+
+  return QUrl(QStringLiteral("scaledcover:") + QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()));
+
+}
+
+bool AlbumCoverLoader::LoadScaledImageFromDiskCache(TaskPtr task) {
+
+  const QUrl cache_url = ScaledCacheUrl(task);
+  if (!cache_url.isValid()) return false;
+
+  const QNetworkCacheMetaData metadata = scaled_disk_cache_->metaData(cache_url);
+  if (!metadata.isValid()) return false;
+
+  ScopedPtr<QIODevice> device(scaled_disk_cache_->data(cache_url));
+  if (!device) return false;
+
+  QImage image_scaled;
+  if (!image_scaled.load(&*device, "PNG") || image_scaled.isNull()) return false;
+  image_scaled.setDevicePixelRatio(task->options.device_pixel_ratio);
+
+  AlbumCoverLoaderResult::Type result_type = AlbumCoverLoaderResult::Type::None;
+  const QNetworkCacheMetaData::RawHeaderList raw_headers = metadata.rawHeaders();
+  for (const QNetworkCacheMetaData::RawHeader &raw_header : raw_headers) {
+    if (raw_header.first == "type") {
+      result_type = static_cast<AlbumCoverLoaderResult::Type>(raw_header.second.toInt());
+    }
+  }
+
+  task->success = true;
+  task->result_type = result_type;
+
+  Q_EMIT AlbumCoverLoaded(task->id, AlbumCoverLoaderResult(true, result_type, task->album_cover, image_scaled, task->art_manual_updated, task->art_automatic_updated));
+
+  return true;
+
+}
+
+void AlbumCoverLoader::SaveScaledImageToDiskCache(TaskPtr task, const QImage &image_scaled) {
+
+  const QUrl cache_url = ScaledCacheUrl(task);
+  if (!cache_url.isValid()) return;
+
+  if (scaled_disk_cache_->metaData(cache_url).isValid()) return;
+
+  QNetworkCacheMetaData metadata;
+  metadata.setSaveToDisk(true);
+  metadata.setUrl(cache_url);
+  metadata.setRawHeaders(QNetworkCacheMetaData::RawHeaderList() << qMakePair(QByteArray("type"), QByteArray::number(static_cast<int>(task->result_type))));
+
+  QIODevice *device = scaled_disk_cache_->prepare(metadata);
+  if (!device) return;
+  if (image_scaled.save(device, "PNG")) {
+    scaled_disk_cache_->insert(device);
+  }
+  else {
+    scaled_disk_cache_->remove(cache_url);
+  }
+
+}
+
 void AlbumCoverLoader::InitArt(TaskPtr task) {
 
   // For local files and streams initialize art if found.
@@ -320,9 +424,16 @@ AlbumCoverLoader::LoadImageResult AlbumCoverLoader::LoadImage(TaskPtr task, cons
 AlbumCoverLoader::LoadImageResult AlbumCoverLoader::LoadEmbeddedImage(TaskPtr task) {
 
   if (task->art_embedded && task->song_url.isValid() && task->song_url.isLocalFile()) {
+    // The tag reader fills the task's buffer directly and the decode reads from the same bytes,
+    // so the only copy of the art is the mandatory one out of TagLib. Resolving the format from
+    // the magic bytes up front also spares the decoder from probing every image plugin.
     const TagReaderResult result = tagreader_client_->LoadCoverDataBlocking(task->song_url.toLocalFile(), task->album_cover.image_data);
-    if (result.success() && !task->album_cover.image_data.isEmpty() && task->album_cover.image.loadFromData(task->album_cover.image_data)) {
-      return LoadImageResult(AlbumCoverLoaderResult::Type::Embedded, LoadImageResult::Status::Success);
+    if (result.success() && !task->album_cover.image_data.isEmpty()) {
+      task->album_cover.mime_type = Utilities::MimeTypeFromData(task->album_cover.image_data);
+      const QByteArray format = QImageReader::imageFormatsForMimeType(task->album_cover.mime_type.toUtf8()).value(0);
+      if (task->album_cover.image.loadFromData(task->album_cover.image_data, format.isEmpty() ? nullptr : format.constData())) {
+        return LoadImageResult(AlbumCoverLoaderResult::Type::Embedded, LoadImageResult::Status::Success);
+      }
     }
   }
 
@@ -33,6 +33,8 @@
 #include <QImage>
 
 #include "includes/shared_ptr.h"
+
+class QNetworkDiskCache;
 #include "core/song.h"
 #include "albumcoverloaderoptions.h"
 #include "albumcoverloaderresult.h"
@@ -119,6 +121,12 @@ class AlbumCoverLoader : public QObject {
   LoadImageResult LoadRemoteUrlImage(TaskPtr task, const AlbumCoverLoaderResult::Type result_type, const QUrl &cover_url);
   void FinishTask(TaskPtr task, const AlbumCoverLoaderResult::Type result_type);
 
+  // The scaled thumbnail disk cache stores one entry per source art, size, device pixel ratio and padding,
+  // so repeated loads skip decoding and rescaling the full-size cover.
+  QUrl ScaledCacheUrl(TaskPtr task) const;
+  bool LoadScaledImageFromDiskCache(TaskPtr task);
+  void SaveScaledImageToDiskCache(TaskPtr task, const QImage &image_scaled);
+
  private Q_SLOTS:
   void Exit();
   void StartProcessTasks();
@@ -128,6 +136,7 @@ class AlbumCoverLoader : public QObject {
  private:
   const SharedPtr<TagReaderClient> tagreader_client_;
   const SharedPtr<NetworkAccessManager> network_;
+  QNetworkDiskCache *scaled_disk_cache_;
   QTimer *timer_process_tasks_;
   bool stop_requested_;
   QMutex mutex_load_image_async_;
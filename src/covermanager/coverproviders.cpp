@@ -40,7 +40,28 @@
 
 int CoverProviders::NextOrderId = 0;
 
-CoverProviders::CoverProviders(QObject *parent) : QObject(parent) {}
+namespace {
+constexpr char kProviderStatsSettingsGroup[] = "CoverProviderStats";
+}
+
+CoverProviders::CoverProviders(QObject *parent) : QObject(parent) {
+
+  // Restore the per-provider success and latency history from the last sessions.
+  Settings s;
+  s.beginGroup(kProviderStatsSettingsGroup);
+  const QStringList provider_names = s.childGroups();
+  for (const QString &provider_name : provider_names) {
+    s.beginGroup(provider_name);
+    ProviderStats stats;
+    stats.searches = s.value("searches", 0).toLongLong();
+    stats.successes = s.value("successes", 0).toLongLong();
+    stats.total_latency_msec = s.value("total_latency_msec", 0).toLongLong();
+    provider_stats_.insert(provider_name, stats);
+    s.endGroup();
+  }
+  s.endGroup();
+
+}
 
 CoverProviders::~CoverProviders() {
 
@@ -139,3 +160,39 @@ void CoverProviders::ProviderDestroyed() {
 }
 
 int CoverProviders::NextId() { return next_id_.fetchAndAddRelaxed(1); }
+
+void CoverProviders::ReportProviderSearch(const QString &provider_name, const bool success, const qint64 latency_msec) {
+
+  QMutexLocker l(&mutex_);
+
+  ProviderStats &stats = provider_stats_[provider_name];
+  ++stats.searches;
+  if (success) ++stats.successes;
+  stats.total_latency_msec += latency_msec;
+
+  Settings s;
+  s.beginGroup(kProviderStatsSettingsGroup);
+  s.beginGroup(provider_name);
+  s.setValue("searches", stats.searches);
+  s.setValue("successes", stats.successes);
+  s.setValue("total_latency_msec", stats.total_latency_msec);
+  s.endGroup();
+  s.endGroup();
+
+}
+
+float CoverProviders::ProviderScoreBonus(const QString &provider_name) const {
+
+  if (!provider_stats_.contains(provider_name)) return 0.0F;
+
+  const ProviderStats &stats = provider_stats_[provider_name];
+  if (stats.searches < 5) return 0.0F;  // Not enough history to be meaningful.
+
+  // Up to +0.5 for a perfect success rate, minus up to 0.25 for slow providers (5 seconds average and above).
+  const float success_rate = static_cast<float>(stats.successes) / static_cast<float>(stats.searches);
+  const float average_latency_msec = static_cast<float>(stats.total_latency_msec) / static_cast<float>(stats.searches);
+  const float latency_penalty = qMin(average_latency_msec / 5000.0F, 1.0F) * 0.25F;
+
+  return success_rate * 0.5F - latency_penalty;
+
+}
@@ -59,6 +59,11 @@ class CoverProviders : public QObject {
 
   int NextId();
 
+  // Historical success rate and latency per provider, persisted across sessions and used to route image loads
+  // toward providers that answer quickly with usable covers.
+  void ReportProviderSearch(const QString &provider_name, const bool success, const qint64 latency_msec);
+  float ProviderScoreBonus(const QString &provider_name) const;
+
  private Q_SLOTS:
   void ProviderDestroyed();
 
@@ -67,6 +72,14 @@ class CoverProviders : public QObject {
 
   static int NextOrderId;
 
+  struct ProviderStats {
+    ProviderStats() : searches(0), successes(0), total_latency_msec(0) {}
+    qint64 searches;
+    qint64 successes;
+    qint64 total_latency_msec;
+  };
+  QMap<QString, ProviderStats> provider_stats_;
+
   QMap<CoverProvider*, QString> cover_providers_;
   QMutex mutex_;
 
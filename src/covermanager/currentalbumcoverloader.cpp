@@ -43,7 +43,8 @@ CurrentAlbumCoverLoader::CurrentAlbumCoverLoader(const SharedPtr<AlbumCoverLoade
     : QObject(parent),
       albumcover_loader_(albumcover_loader),
       temp_file_pattern_(QStandardPaths::writableLocation(QStandardPaths::TempLocation) + u"/strawberry-cover-XXXXXX.jpg"_s),
-      id_(0) {
+      id_(0),
+      have_last_result_(false) {
 
   setObjectName(QLatin1String(metaObject()->className()));
 
@@ -69,11 +70,48 @@ void CurrentAlbumCoverLoader::ReloadSettings() {
 
   options_.types = AlbumCoverLoaderOptions::LoadTypes();
 
+  // The cover types changed, results loaded with the old types can't be reused.
+  have_last_result_ = false;
+  last_loaded_cover_key_.clear();
+
+}
+
+QString CurrentAlbumCoverLoader::CoverKeyForSong(const Song &song) {
+
+  // With no art fields set the loader can still discover art next to the file, which is per directory, not shared between songs.
+  if (!song.art_embedded() && song.art_manual().isEmpty() && song.art_automatic().isEmpty() && !song.art_unset()) {
+    return song.url().toString();
+  }
+
+  return QStringLiteral("%1|%2|%3|%4").arg(song.art_embedded() ? song.url().toString() : QString(), song.art_manual().toString(), song.art_automatic().toString(), QString::number(song.art_unset() ? 1 : 0));
+
 }
 
 void CurrentAlbumCoverLoader::LoadAlbumCover(const Song &song) {
 
   last_song_ = song;
+
+  const QString cover_key = CoverKeyForSong(song);
+
+  // Same art as the load already in flight, that one serves this song too.
+  if (id_ != 0 && cover_key == pending_cover_key_) {
+    return;
+  }
+
+  // Same art as the last completed load, including loads that found no cover, so re-emit the cached result.
+  if (have_last_result_ && cover_key == last_loaded_cover_key_) {
+    if (last_result_.art_manual_updated.isValid()) {
+      last_song_.set_art_manual(last_result_.art_manual_updated);
+    }
+    if (last_result_.art_automatic_updated.isValid()) {
+      last_song_.set_art_automatic(last_result_.art_automatic_updated);
+    }
+    Q_EMIT AlbumCoverLoaded(last_song_, last_result_);
+    Q_EMIT ThumbnailLoaded(last_song_, last_thumbnail_url_, last_result_.image_scaled);
+    return;
+  }
+
+  pending_cover_key_ = cover_key;
   id_ = albumcover_loader_->LoadImageAsync(options_, last_song_);
 
 }
@@ -121,6 +159,11 @@ void CurrentAlbumCoverLoader::AlbumCoverReady(const quint64 id, AlbumCoverLoader
     last_song_.set_art_automatic(result.art_automatic_updated);
   }
 
+  last_loaded_cover_key_ = pending_cover_key_;
+  have_last_result_ = true;
+  last_result_ = result;
+  last_thumbnail_url_ = thumbnail_url;
+
   Q_EMIT AlbumCoverLoaded(last_song_, result);
   Q_EMIT ThumbnailLoaded(last_song_, thumbnail_url, result.image_scaled);
 
@@ -28,6 +28,7 @@
 #include <QObject>
 #include <QString>
 #include <QImage>
+#include <QUrl>
 
 #include "includes/scoped_ptr.h"
 #include "includes/shared_ptr.h"
@@ -61,6 +62,9 @@ class CurrentAlbumCoverLoader : public QObject {
  private Q_SLOTS:
   void AlbumCoverReady(const quint64 id, AlbumCoverLoaderResult result);
 
+ private:
+  static QString CoverKeyForSong(const Song &song);
+
  private:
   const SharedPtr<AlbumCoverLoader> albumcover_loader_;
   AlbumCoverLoaderOptions options_;
@@ -72,6 +76,14 @@ class CurrentAlbumCoverLoader : public QObject {
   quint64 id_;
 
   Song last_song_;
+
+  // Consecutive tracks of an album share the same art, so the last result (including "no cover") is cached
+  // by art key and re-emitted instead of loading and saving temporary covers again.
+  QString pending_cover_key_;
+  QString last_loaded_cover_key_;
+  bool have_last_result_;
+  AlbumCoverLoaderResult last_result_;
+  QUrl last_thumbnail_url_;
 };
 
 #endif  // CURRENTALBUMCOVERLOADER_H
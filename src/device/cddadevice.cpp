@@ -57,7 +57,7 @@ CddaDevice::CddaDevice(const QUrl &url,
 bool CddaDevice::Init() {
 
   song_count_ = 0;  // Reset song count, in case it was already set
-  cdda_song_loader_.LoadSongs();
+  cdda_song_loader_.LoadSongsAsync();
   return true;
 
 }
@@ -34,6 +34,7 @@
 #include <QByteArray>
 #include <QString>
 #include <QUrl>
+#include <QtConcurrentRun>
 
 #include <cdio/cdio.h>
 #include <gst/gst.h>
@@ -57,6 +58,8 @@ CddaSongLoader::CddaSongLoader(const QUrl &url, QObject *parent)
       cdio_(nullptr) {}
 
 CddaSongLoader::~CddaSongLoader() {
+  // The worker captures this; ejecting or removing the device can destroy the loader while the TOC read is still running.
+  load_future_.waitForFinished();
   if (cdio_) cdio_destroy(cdio_);
 }
 
@@ -70,6 +73,12 @@ QUrl CddaSongLoader::GetUrlFromTrack(int track_number) const {
 
 }
 
+void CddaSongLoader::LoadSongsAsync() {
+
+  load_future_ = QtConcurrent::run(&CddaSongLoader::LoadSongs, this);
+
+}
+
 void CddaSongLoader::LoadSongs() {
 
   QMutexLocker locker(&mutex_load_);
@@ -26,6 +26,7 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QFuture>
 #include <QString>
 #include <QUrl>
 
@@ -52,6 +53,8 @@ class CddaSongLoader : public QObject {
   ~CddaSongLoader() override;
 
   // Load songs. Signals declared below will be emitted anytime new information will be available.
+  // Runs LoadSongs on a worker thread; progress is reported through the signals as each stage completes.
+  void LoadSongsAsync();
   void LoadSongs();
   bool HasChanged();
 
@@ -76,6 +79,7 @@ class CddaSongLoader : public QObject {
   GstElement *cdda_;
   CdIo_t *cdio_;
   QMutex mutex_load_;
+  QFuture<void> load_future_;
 };
 
 #endif  // CDDASONGLOADER_H
@@ -41,7 +41,7 @@
 using namespace Qt::Literals::StringLiterals;
 
 namespace {
-constexpr int kDeviceSchemaVersion = 5;
+constexpr int kDeviceSchemaVersion = 6;
 }
 
 DeviceDatabaseBackend::DeviceDatabaseBackend(QObject *parent)
@@ -162,6 +162,12 @@ int DeviceDatabaseBackend::AddDevice(const Device &device) {
 
 }
 
+void DeviceDatabaseBackend::RemoveDeviceAsync(const int id) {
+
+  QMetaObject::invokeMethod(this, [this, id]() { RemoveDevice(id); }, Qt::QueuedConnection);
+
+}
+
 void DeviceDatabaseBackend::RemoveDevice(const int id) {
 
   QMutexLocker l(db_->Mutex());
@@ -221,6 +227,12 @@ void DeviceDatabaseBackend::RemoveDevice(const int id) {
 
 }
 
+void DeviceDatabaseBackend::SetDeviceOptionsAsync(const int id, const QString &friendly_name, const QString &icon_name, const MusicStorage::TranscodeMode mode, const Song::FileType format) {
+
+  QMetaObject::invokeMethod(this, [this, id, friendly_name, icon_name, mode, format]() { SetDeviceOptions(id, friendly_name, icon_name, mode, format); }, Qt::QueuedConnection);
+
+}
+
 void DeviceDatabaseBackend::SetDeviceOptions(const int id, const QString &friendly_name, const QString &icon_name, const MusicStorage::TranscodeMode mode, const Song::FileType format) {
 
   QMutexLocker l(db_->Mutex());
@@ -64,8 +64,10 @@ class DeviceDatabaseBackend : public QObject {
 
   DeviceList GetAllDevices();
   int AddDevice(const Device &device);
+  void RemoveDeviceAsync(const int id);
   void RemoveDevice(const int id);
 
+  void SetDeviceOptionsAsync(const int id, const QString &friendly_name, const QString &icon_name, const MusicStorage::TranscodeMode mode, const Song::FileType format);
   void SetDeviceOptions(const int id, const QString &friendly_name, const QString &icon_name, const MusicStorage::TranscodeMode mode, const Song::FileType format);
 
  private Q_SLOTS:
@@ -24,12 +24,14 @@
 #include <utility>
 #include <functional>
 #include <memory>
+#include <chrono>
 
 #include <QtGlobal>
 #include <QApplication>
 #include <QObject>
 #include <QMetaObject>
 #include <QThread>
+#include <QTimer>
 #include <QtConcurrentRun>
 #include <QAbstractItemModel>
 #include <QDir>
@@ -83,6 +85,7 @@
 
 using namespace Qt::Literals::StringLiterals;
 using std::make_unique;
+using namespace std::chrono_literals;
 
 const int DeviceManager::kDeviceIconSize = 32;
 const int DeviceManager::kDeviceIconOverlaySize = 16;
@@ -118,19 +121,8 @@ DeviceManager::DeviceManager(const SharedPtr<TaskManager> task_manager,
   connected_devices_model_ = new DeviceStateFilterModel(this);
   connected_devices_model_->setSourceModel(this);
 
-// CD devices are detected via the DiskArbitration framework instead on MacOs.
-#if defined(HAVE_AUDIOCD) && !defined(Q_OS_MACOS)
-  AddLister(new CddaLister);
-#endif
-#ifdef HAVE_UDISKS2
-  AddLister(new Udisks2Lister);
-#endif
-#ifdef HAVE_GIO
-  AddLister(new GioLister);
-#endif
-#ifdef Q_OS_MACOS
-  AddLister(new MacOsDeviceLister);
-#endif
+  // Each lister starts its own thread and probes the system, keep that off the critical startup path.
+  QTimer::singleShot(2s, this, &DeviceManager::StartListers);
 
 #ifdef HAVE_AUDIOCD
   AddDeviceClass<CddaDevice>();
@@ -148,6 +140,24 @@ DeviceManager::DeviceManager(const SharedPtr<TaskManager> task_manager,
 
 }
 
+void DeviceManager::StartListers() {
+
+// CD devices are detected via the DiskArbitration framework instead on MacOs.
+#if defined(HAVE_AUDIOCD) && !defined(Q_OS_MACOS)
+  AddLister(new CddaLister);
+#endif
+#ifdef HAVE_UDISKS2
+  AddLister(new Udisks2Lister);
+#endif
+#ifdef HAVE_GIO
+  AddLister(new GioLister);
+#endif
+#ifdef Q_OS_MACOS
+  AddLister(new MacOsDeviceLister);
+#endif
+
+}
+
 DeviceManager::~DeviceManager() {
 
   for (DeviceLister *lister : std::as_const(listers_)) {
@@ -795,7 +805,7 @@ void DeviceManager::Forget(const QModelIndex &idx) {
 
 void DeviceManager::RemoveFromDB(DeviceInfo *info, const QModelIndex &idx) {
 
-  backend_->RemoveDevice(info->database_id_);
+  backend_->RemoveDeviceAsync(info->database_id_);
   info->database_id_ = -1;
 
   if (!info->BestBackend() || !info->BestBackend()->lister_) {  // It's not attached any more so remove it from the list
@@ -829,7 +839,7 @@ void DeviceManager::SetDeviceOptions(const QModelIndex &idx, const QString &frie
   Q_EMIT dataChanged(idx, idx);
 
   if (info->database_id_ != -1) {
-    backend_->SetDeviceOptions(info->database_id_, friendly_name, icon_name, mode, format);
+    backend_->SetDeviceOptionsAsync(info->database_id_, friendly_name, icon_name, mode, format);
   }
 
 }
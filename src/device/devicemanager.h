@@ -134,6 +134,7 @@ class DeviceManager : public SimpleTreeModel<DeviceInfo> {
   void DeviceError(const QString &error);
 
  private Q_SLOTS:
+  void StartListers();
   void PhysicalDeviceAdded(const QString &id);
   void PhysicalDeviceRemoved(const QString &id);
   void PhysicalDeviceChanged(const QString &id);
@@ -30,7 +30,8 @@
 
 DeviceStateFilterModel::DeviceStateFilterModel(QObject *parent, DeviceManager::State state)
     : QSortFilterProxyModel(parent),
-      state_(state) {
+      state_(state),
+      last_empty_(true) {
 
   QObject::connect(this, &DeviceStateFilterModel::rowsInserted, this, &DeviceStateFilterModel::ProxyRowCountChanged);
   QObject::connect(this, &DeviceStateFilterModel::rowsRemoved, this, &DeviceStateFilterModel::ProxyRowCountChanged);
@@ -40,7 +41,8 @@ DeviceStateFilterModel::DeviceStateFilterModel(QObject *parent, DeviceManager::S
 
 bool DeviceStateFilterModel::filterAcceptsRow(const int row, const QModelIndex &parent) const {
   Q_UNUSED(parent)
-  return sourceModel()->index(row, 0).data(DeviceManager::Role_State).toInt() != state_ && sourceModel()->index(row, 0).data(DeviceManager::Role_CopyMusic).toBool();
+  const QModelIndex idx = sourceModel()->index(row, 0);
+  return idx.data(DeviceManager::Role_State).toInt() != state_ && idx.data(DeviceManager::Role_CopyMusic).toBool();
 }
 
 void DeviceStateFilterModel::ProxyRowCountChanged(const QModelIndex &idx, const int first, const int last) {
@@ -49,13 +51,24 @@ void DeviceStateFilterModel::ProxyRowCountChanged(const QModelIndex &idx, const
   Q_UNUSED(first);
   Q_UNUSED(last);
 
-  Q_EMIT IsEmptyChanged(rowCount() == 0);
+  EmitIsEmptyChanged();
 
 }
 
 void DeviceStateFilterModel::ProxyReset() {
 
-  Q_EMIT IsEmptyChanged(rowCount() == 0);
+  EmitIsEmptyChanged();
+
+}
+
+void DeviceStateFilterModel::EmitIsEmptyChanged() {
+
+  // Device probing fires bursts of row changes; only forward the transitions consumers care about.
+  const bool empty = rowCount() == 0;
+  if (empty == last_empty_) return;
+  last_empty_ = empty;
+
+  Q_EMIT IsEmptyChanged(empty);
 
 }
 
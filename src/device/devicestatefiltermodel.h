@@ -49,10 +49,12 @@ class DeviceStateFilterModel : public QSortFilterProxyModel {
 
  private Q_SLOTS:
   void ProxyReset();
+  void EmitIsEmptyChanged();
   void ProxyRowCountChanged(const QModelIndex &idx, const int first, const int last);
 
  private:
   DeviceManager::State state_;
+  bool last_empty_;
 };
 
 #endif  // DEVICESTATEFILTERMODEL_H
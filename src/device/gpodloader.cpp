@@ -21,11 +21,14 @@
 
 #include "config.h"
 
+#include <utility>
+
 #include <glib.h>
 #include <gpod/itdb.h>
 
 #include <QObject>
 #include <QDir>
+#include <QHash>
 #include <QByteArray>
 #include <QString>
 
@@ -106,12 +109,34 @@ Itdb_iTunesDB *GPodLoader::TryLoad() {
     songs << song;
   }
 
-  // Need to remove all the existing songs in the database first
-  backend_->DeleteSongs(backend_->FindSongsInDirectory(1));
+  // If the device content matches what we have cached from the last load, keep the cached songs instead of rewriting them all.
+  const SongList existing_songs = backend_->FindSongsInDirectory(1);
+  bool unchanged = !songs.isEmpty() && existing_songs.count() == songs.count();
+  if (unchanged) {
+    QHash<QUrl, qint64> existing_mtimes;
+    existing_mtimes.reserve(existing_songs.count());
+    for (const Song &existing_song : existing_songs) {
+      existing_mtimes.insert(existing_song.url(), existing_song.mtime());
+    }
+    for (const Song &song : std::as_const(songs)) {
+      if (!existing_mtimes.contains(song.url()) || existing_mtimes.value(song.url()) != song.mtime()) {
+        unchanged = false;
+        break;
+      }
+    }
+  }
 
   if (!abort_) {
-    // Add the songs we've just loaded
-    backend_->AddOrUpdateSongs(songs);
+    if (unchanged) {
+      qLog(Debug) << "iPod database unchanged, keeping cached songs";
+    }
+    else {
+      // Need to remove all the existing songs in the database first
+      backend_->DeleteSongs(existing_songs);
+
+      // Add the songs we've just loaded
+      backend_->AddOrUpdateSongs(songs);
+    }
   }
 
   // This is done in the loader thread so close the unique DB connection.
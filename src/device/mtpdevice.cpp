@@ -263,6 +263,12 @@ bool MtpDevice::FinishDelete(const bool success, QString &error_text) { return F
 bool MtpDevice::GetSupportedFiletypes(QList<Song::FileType> *ret) {
 
   QMutexLocker l(&db_busy_);
+
+  // Reuse the open device session when there is one, establishing an MTP session takes seconds on some devices.
+  if (connection_ && connection_->is_valid()) {
+    return GetSupportedFiletypes(ret, connection_->device());
+  }
+
   MtpConnection connection(url_);
 
   if (!connection.is_valid()) {
@@ -30,7 +30,7 @@
 #include <QtGlobal>
 #include <QCoreApplication>
 #include <QThread>
-#include <QIODevice>
+#include <QSemaphore>
 #include <QByteArray>
 #include <QString>
 #include <QElapsedTimer>
@@ -54,7 +54,8 @@ constexpr int kTimeoutSecs = 10;
 
 Chromaprinter::Chromaprinter(const QString &filename)
     : filename_(filename),
-      convert_element_(nullptr) {}
+      convert_element_(nullptr),
+      chromaprint_(nullptr) {}
 
 GstElement *Chromaprinter::CreateElement(const QString &factory_name, GstElement *bin) {
 
@@ -74,11 +75,14 @@ QString Chromaprinter::CreateFingerprint() {
 
   Q_ASSERT(QThread::currentThread() != qApp->thread());
 
-  if (!buffer_.open(QIODevice::WriteOnly)) return QString();
+  // Every fingerprint decodes the file through its own pipeline; bound the number running at once
+  // so parallel callers (scans, tag fetching) can't spawn an unbounded number of decoders.
+  static QSemaphore fingerprint_slots(qBound(1, QThread::idealThreadCount() / 2, 4));
+  fingerprint_slots.acquire();
+  const QSemaphoreReleaser releaser(fingerprint_slots);
 
   GstElement *pipeline = gst_pipeline_new("pipeline");
   if (!pipeline) {
-    buffer_.close();
     return QString();
   }
 
@@ -90,10 +94,13 @@ QString Chromaprinter::CreateFingerprint() {
 
   if (!src || !decode || !convert || !resample || !sink) {
     gst_object_unref(pipeline);
-    buffer_.close();
     return QString();
   }
 
+  // The context is created up front so the appsink callback can feed the mapped buffers into it directly.
+  chromaprint_ = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
+  chromaprint_start(chromaprint_, kDecodeRate, kDecodeChannels);
+
   convert_element_ = convert;
 
   // Connect the elements
@@ -151,19 +158,19 @@ QString Chromaprinter::CreateFingerprint() {
 
   const qint64 decode_time = time.restart();
 
-  buffer_.close();
-
-  // Generate fingerprint from recorded buffer data
-  QByteArray data = buffer_.data();
+  // On timeout or mid-stream error the streaming thread is still feeding the appsink callback;
+  // take the pipeline down and detach the callback before touching the chromaprint context.
+  GstAppSinkCallbacks no_callbacks;
+  memset(&no_callbacks, 0, sizeof(no_callbacks));
+  gst_app_sink_set_callbacks(reinterpret_cast<GstAppSink*>(sink), &no_callbacks, nullptr, nullptr);
+  gst_element_set_state(pipeline, GST_STATE_NULL);
 
-  ChromaprintContext *chromaprint = chromaprint_new(CHROMAPRINT_ALGORITHM_DEFAULT);
-  chromaprint_start(chromaprint, kDecodeRate, kDecodeChannels);
-  chromaprint_feed(chromaprint, reinterpret_cast<int16_t*>(data.data()), static_cast<int>(data.size() / 2));
-  chromaprint_finish(chromaprint);
+  // All samples were already fed from the appsink callback
+  chromaprint_finish(chromaprint_);
 
   u_int32_t *fprint = nullptr;
   int size = 0;
-  int ret = chromaprint_get_raw_fingerprint(chromaprint, &fprint, &size);
+  int ret = chromaprint_get_raw_fingerprint(chromaprint_, &fprint, &size);
   QByteArray fingerprint;
   if (ret == 1) {
     char *encoded = nullptr;
@@ -175,16 +182,15 @@ QString Chromaprinter::CreateFingerprint() {
     }
     chromaprint_dealloc(fprint);
   }
-  chromaprint_free(chromaprint);
+  chromaprint_free(chromaprint_);
+  chromaprint_ = nullptr;
 
   const qint64 codegen_time = time.elapsed();
 
   qLog(Debug) << "Decode time:" << decode_time << "Codegen time:" << codegen_time;
 
   // Cleanup
-  callbacks.new_sample = nullptr;
   gst_object_unref(bus);
-  gst_element_set_state(pipeline, GST_STATE_NULL);
   gst_object_unref(pipeline);
 
   return QString::fromUtf8(fingerprint);
@@ -218,7 +224,8 @@ GstFlowReturn Chromaprinter::NewBufferCallback(GstAppSink *app_sink, gpointer se
   if (buffer) {
     GstMapInfo map;
     if (gst_buffer_map(buffer, &map, GST_MAP_READ)) {
-      me->buffer_.write(reinterpret_cast<const char*>(map.data), static_cast<qint64>(map.size));
+      // Feed the mapped samples straight into chromaprint instead of accumulating a copy of the decoded audio.
+      chromaprint_feed(me->chromaprint_, reinterpret_cast<int16_t*>(map.data), static_cast<int>(map.size / 2));
       gst_buffer_unmap(buffer, &map);
     }
   }
@@ -27,8 +27,8 @@
 #include <glib.h>
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
+#include <chromaprint.h>
 
-#include <QBuffer>
 #include <QString>
 
 class Chromaprinter {
@@ -57,7 +57,8 @@ class Chromaprinter {
 
   GstElement *convert_element_;
 
-  QBuffer buffer_;
+  // Samples are fed straight from the mapped GStreamer buffers into this context, without accumulating a copy.
+  ChromaprintContext *chromaprint_;
 };
 
 #endif  // CHROMAPRINTER_H
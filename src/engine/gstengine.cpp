@@ -40,6 +40,7 @@
 #include <QMutexLocker>
 #include <QTimer>
 #include <QList>
+#include <QDateTime>
 #include <QByteArray>
 #include <QChar>
 #include <QString>
@@ -52,6 +53,8 @@
 
 #include "includes/shared_ptr.h"
 #include "core/logging.h"
+#include "core/settings.h"
+#include "constants/backendsettings.h"
 #include "core/taskmanager.h"
 #include "core/signalchecker.h"
 #include "core/enginemetadata.h"
@@ -99,6 +102,9 @@ GstEngine::GstEngine(SharedPtr<TaskManager> task_manager, QObject *parent)
       task_manager_(task_manager),
       discoverer_(nullptr),
       buffering_task_id_(-1),
+      buffer_auto_tune_(false),
+      buffer_duration_tuned_nanosec_(0),
+      buffering_completed_for_current_pipeline_(false),
       latest_buffer_(nullptr),
       stereo_balancer_enabled_(false),
       stereo_balance_(0.0F),
@@ -112,6 +118,7 @@ GstEngine::GstEngine(SharedPtr<TaskManager> task_manager, QObject *parent)
       scope_chunk_(0),
       have_new_buffer_(false),
       scope_chunks_(0),
+      buffer_format_supported_(false),
       discovery_finished_cb_id_(-1),
       discovery_discovered_cb_id_(-1),
       delayed_state_(State::Empty),
@@ -129,6 +136,7 @@ GstEngine::GstEngine(SharedPtr<TaskManager> task_manager, QObject *parent)
 GstEngine::~GstEngine() {
 
   current_pipeline_.reset();
+  standby_pipeline_.reset();
 
   if (latest_buffer_) {
     gst_buffer_unref(latest_buffer_);
@@ -511,6 +519,22 @@ void GstEngine::ReloadSettings() {
 
   if (output_.isEmpty()) output_ = QLatin1String(kAutoSink);
 
+  {
+    Settings s;
+    s.beginGroup(BackendSettings::kSettingsGroup);
+    buffer_auto_tune_ = s.value(BackendSettings::kBufferAutoTune, false).toBool();
+    s.endGroup();
+  }
+
+  // The configured buffer duration changed, drop what auto-tuning learned.
+  buffer_duration_tuned_nanosec_ = 0;
+  buffer_underrun_times_.clear();
+
+  // The standby pipeline was built with the old settings; rebuild it right away so switching
+  // the output device restarts playback on a pre-built graph instead of rebuilding at play time.
+  InvalidateStandbyPipeline();
+  QMetaObject::invokeMethod(this, &GstEngine::PrewarmStandbyPipeline, Qt::QueuedConnection);
+
 }
 
 void GstEngine::ConsumeBuffer(GstBuffer *buffer, const int pipeline_id, const QString &format) {
@@ -527,6 +551,7 @@ void GstEngine::SetStereoBalancerEnabled(const bool enabled) {
 
   stereo_balancer_enabled_ = enabled;
   if (current_pipeline_) current_pipeline_->set_stereo_balancer_enabled(enabled);
+  InvalidateStandbyPipeline();
 
 }
 
@@ -541,6 +566,7 @@ void GstEngine::SetEqualizerEnabled(const bool enabled) {
 
   equalizer_enabled_ = enabled;
   if (current_pipeline_) current_pipeline_->set_equalizer_enabled(enabled);
+  InvalidateStandbyPipeline();
 
 }
 
@@ -557,6 +583,7 @@ void GstEngine::AddBufferConsumer(GstBufferConsumer *consumer) {
 
   buffer_consumers_ << consumer;
   if (current_pipeline_) current_pipeline_->AddBufferConsumer(consumer);
+  if (standby_pipeline_) standby_pipeline_->AddBufferConsumer(consumer);
 
 }
 
@@ -564,6 +591,7 @@ void GstEngine::RemoveBufferConsumer(GstBufferConsumer *consumer) {
 
   buffer_consumers_.removeAll(consumer);
   if (current_pipeline_) current_pipeline_->RemoveBufferConsumer(consumer);
+  if (standby_pipeline_) standby_pipeline_->RemoveBufferConsumer(consumer);
 
 }
 
@@ -667,6 +695,12 @@ void GstEngine::AddBufferToScope(GstBuffer *buf, const int pipeline_id, const QS
   }
 
   buffer_format_ = format;
+  buffer_format_supported_ = format.startsWith("S16LE"_L1) ||
+                             format.startsWith("U16LE"_L1) ||
+                             format.startsWith("S24LE"_L1) ||
+                             format.startsWith("S24_32LE"_L1) ||
+                             format.startsWith("S32LE"_L1) ||
+                             format.startsWith("F32LE"_L1);
   latest_buffer_ = buf;
   have_new_buffer_ = true;
 
@@ -775,12 +809,44 @@ void GstEngine::BufferingStarted() {
   buffering_task_id_ = task_manager_->StartTask(tr("Buffering"));
   task_manager_->SetTaskProgress(buffering_task_id_, 0, 100);
 
+  // The initial prebuffer of every track also reports buffering; only refills after playback started are underruns.
+  if (buffer_auto_tune_ && buffering_completed_for_current_pipeline_) {
+    constexpr qint64 kUnderrunWindowMsec = 60 * kMsecPerSec;
+    constexpr qint64 kMaxTunedBufferNanosec = 10LL * kNsecPerSec;
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    buffer_underrun_times_ << now;
+    while (!buffer_underrun_times_.isEmpty() && buffer_underrun_times_.first() < now - kUnderrunWindowMsec) {
+      buffer_underrun_times_.removeFirst();
+    }
+    // Two underruns within the window means the configured buffer is too small for this connection, double it for the next pipelines.
+    if (buffer_underrun_times_.count() >= 2) {
+      const qint64 current_duration_nanosec = buffer_duration_tuned_nanosec_ > 0 ? buffer_duration_tuned_nanosec_ : buffer_duration_nanosec_;
+      const qint64 new_duration_nanosec = qMin(current_duration_nanosec * 2, kMaxTunedBufferNanosec);
+      if (new_duration_nanosec > current_duration_nanosec) {
+        qLog(Debug) << "Repeated buffer underruns, growing buffer duration from" << current_duration_nanosec / kNsecPerMsec << "ms to" << new_duration_nanosec / kNsecPerMsec << "ms";
+        buffer_duration_tuned_nanosec_ = new_duration_nanosec;
+        buffer_underrun_times_.clear();
+      }
+    }
+  }
+
 }
 
 void GstEngine::BufferingProgress(const int percent) {
   task_manager_->SetTaskProgress(buffering_task_id_, percent, 100);
 }
 
+void GstEngine::PipelineBufferingFinished(const int pipeline_id) {
+
+  // Only the pipeline's own buffering completion counts; BufferingFinished() is also called directly to clean up the task on stop/error.
+  if (current_pipeline_ && current_pipeline_->id() == pipeline_id) {
+    buffering_completed_for_current_pipeline_ = true;
+  }
+
+  BufferingFinished();
+
+}
+
 void GstEngine::BufferingFinished() {
 
   if (buffering_task_id_ != -1) {
@@ -837,7 +903,7 @@ void GstEngine::StartFadeout(GstEnginePipelinePtr pipeline) {
   QObject::disconnect(&*pipeline, &GstEnginePipeline::MetadataFound, this, &GstEngine::NewMetaData);
   QObject::disconnect(&*pipeline, &GstEnginePipeline::BufferingStarted, this, &GstEngine::BufferingStarted);
   QObject::disconnect(&*pipeline, &GstEnginePipeline::BufferingProgress, this, &GstEngine::BufferingProgress);
-  QObject::disconnect(&*pipeline, &GstEnginePipeline::BufferingFinished, this, &GstEngine::BufferingFinished);
+  QObject::disconnect(&*pipeline, &GstEnginePipeline::BufferingFinished, this, &GstEngine::PipelineBufferingFinished);
   QObject::disconnect(&*pipeline, &GstEnginePipeline::VolumeChanged, this, &EngineBase::UpdateVolume);
   QObject::disconnect(&*pipeline, &GstEnginePipeline::AboutToFinish, this, &EngineBase::EmitAboutToFinish);
 
@@ -895,7 +961,7 @@ GstEnginePipelinePtr GstEngine::CreatePipeline() {
   pipeline->set_equalizer_enabled(equalizer_enabled_);
   pipeline->set_replaygain(rg_enabled_, rg_mode_, rg_preamp_, rg_fallbackgain_, rg_compression_);
   pipeline->set_ebur128_loudness_normalization(ebur128_loudness_normalization_);
-  pipeline->set_buffer_duration_nanosec(buffer_duration_nanosec_);
+  pipeline->set_buffer_duration_nanosec(buffer_auto_tune_ && buffer_duration_tuned_nanosec_ > 0 ? buffer_duration_tuned_nanosec_ : buffer_duration_nanosec_);
   pipeline->set_buffer_low_watermark(buffer_low_watermark_);
   pipeline->set_buffer_high_watermark(buffer_high_watermark_);
   pipeline->set_proxy_settings(proxy_address_, proxy_authentication_, proxy_user_, proxy_pass_);
@@ -918,7 +984,7 @@ GstEnginePipelinePtr GstEngine::CreatePipeline() {
   QObject::connect(&*pipeline, &GstEnginePipeline::MetadataFound, this, &GstEngine::NewMetaData);
   QObject::connect(&*pipeline, &GstEnginePipeline::BufferingStarted, this, &GstEngine::BufferingStarted);
   QObject::connect(&*pipeline, &GstEnginePipeline::BufferingProgress, this, &GstEngine::BufferingProgress);
-  QObject::connect(&*pipeline, &GstEnginePipeline::BufferingFinished, this, &GstEngine::BufferingFinished);
+  QObject::connect(&*pipeline, &GstEnginePipeline::BufferingFinished, this, &GstEngine::PipelineBufferingFinished);
   QObject::connect(&*pipeline, &GstEnginePipeline::VolumeChanged, this, &EngineBase::UpdateVolume);
   QObject::connect(&*pipeline, &GstEnginePipeline::AboutToFinish, this, &EngineBase::EmitAboutToFinish);
 
@@ -926,9 +992,48 @@ GstEnginePipelinePtr GstEngine::CreatePipeline() {
 
 }
 
+void GstEngine::PrewarmStandbyPipeline() {
+
+  if (standby_pipeline_) return;
+
+  GstEnginePipelinePtr pipeline = CreatePipeline();
+  QString error;
+  if (pipeline->InitPipeline(error)) {
+    standby_pipeline_ = pipeline;
+  }
+  else {
+    qLog(Warning) << "Failed to pre-roll standby pipeline:" << error;
+    QObject::disconnect(&*pipeline, nullptr, this, nullptr);
+  }
+
+}
+
+void GstEngine::InvalidateStandbyPipeline() {
+
+  if (!standby_pipeline_) return;
+
+  QObject::disconnect(&*standby_pipeline_, nullptr, this, nullptr);
+  standby_pipeline_.reset();
+
+}
+
 GstEnginePipelinePtr GstEngine::CreatePipeline(const QUrl &media_url, const QUrl &stream_url, const QByteArray &gst_url, const qint64 end_nanosec, const double ebur128_loudness_normalizing_gain_db) {
 
-  GstEnginePipelinePtr ret = CreatePipeline();
+  buffering_completed_for_current_pipeline_ = false;
+
+  GstEnginePipelinePtr ret;
+  if (standby_pipeline_) {
+    // Use the pre-rolled pipeline, its element graph is already built.
+    ret = standby_pipeline_;
+    standby_pipeline_.reset();
+  }
+  else {
+    ret = CreatePipeline();
+  }
+
+  // Pre-roll a replacement for the next track start once this one is on its way.
+  QMetaObject::invokeMethod(this, &GstEngine::PrewarmStandbyPipeline, Qt::QueuedConnection);
+
   QString error;
   if (!ret->InitFromUrl(media_url, stream_url, gst_url, end_nanosec, ebur128_loudness_normalizing_gain_db, error)) {
     ret.reset();
@@ -1034,13 +1139,7 @@ void GstEngine::UpdateScope(const int chunk_length) {
 
   scope_chunk_++;
 
-  if (buffer_format_.startsWith("S16LE"_L1) ||
-      buffer_format_.startsWith("U16LE"_L1) ||
-      buffer_format_.startsWith("S24LE"_L1) ||
-      buffer_format_.startsWith("S24_32LE"_L1) ||
-      buffer_format_.startsWith("S32LE"_L1) ||
-      buffer_format_.startsWith("F32LE"_L1)
-  ) {
+  if (buffer_format_supported_) {
     memcpy(dest, source, bytes);
   }
   else {
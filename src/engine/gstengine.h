@@ -118,6 +118,7 @@ class GstEngine : public EngineBase, public GstBufferConsumer {
 
   void BufferingStarted();
   void BufferingProgress(int percent);
+  void PipelineBufferingFinished(const int pipeline_id);
   void BufferingFinished();
 
   void PipelineFinished(const int pipeline_id);
@@ -133,6 +134,8 @@ class GstEngine : public EngineBase, public GstBufferConsumer {
   void StopTimers();
 
   GstEnginePipelinePtr CreatePipeline();
+  void PrewarmStandbyPipeline();
+  void InvalidateStandbyPipeline();
   GstEnginePipelinePtr CreatePipeline(const QUrl &media_url, const QUrl &stream_url, const QByteArray &gst_url, const qint64 end_nanosec, const double ebur128_loudness_normalizing_gain_db);
 
   void FinishPipeline(GstEnginePipelinePtr pipeline);
@@ -152,7 +155,16 @@ class GstEngine : public EngineBase, public GstBufferConsumer {
 
   int buffering_task_id_;
 
+  // Adaptive buffer tuning: repeated underruns within a short window grow the buffer used for the next pipelines.
+  bool buffer_auto_tune_;
+  qint64 buffer_duration_tuned_nanosec_;
+  QList<qint64> buffer_underrun_times_;
+  // Every network track prebuffers once before playing; only buffering that interrupts playback counts as an underrun.
+  bool buffering_completed_for_current_pipeline_;
+
   GstEnginePipelinePtr current_pipeline_;
+  // A pipeline with its element graph already built, waiting for a URL, so track start doesn't pay for element creation.
+  GstEnginePipelinePtr standby_pipeline_;
   QMap<int, GstEnginePipelinePtr> fadeout_pipelines_;
   GstEnginePipelinePtr fadeout_pause_pipeline_;
   QMap<int, GstEnginePipelinePtr> old_pipelines_;
@@ -181,6 +193,8 @@ class GstEngine : public EngineBase, public GstBufferConsumer {
   bool have_new_buffer_;
   int scope_chunks_;
   QString buffer_format_;
+  // Resolved once per buffer so the per-chunk scope copy doesn't re-match format strings.
+  bool buffer_format_supported_;
 
   int discovery_finished_cb_id_;
   int discovery_discovered_cb_id_;
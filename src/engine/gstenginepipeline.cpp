@@ -31,6 +31,10 @@
 #include <glib-object.h>
 #include <gst/gst.h>
 #include <gst/audio/audio.h>
+#include <gst/controller/gstinterpolationcontrolsource.h>
+#include <gst/controller/gsttimedvaluecontrolsource.h>
+#include <gst/controller/gstdirectcontrolbinding.h>
+#include <gst/base/gstbasetransform.h>
 
 #ifdef Q_OS_UNIX
 #  include <pthread.h>
@@ -146,6 +150,8 @@ GstEnginePipeline::GstEnginePipeline(QObject *parent)
       fader_active_(false),
       fader_running_(false),
       fader_use_fudge_timer_(false),
+      fader_control_source_(nullptr),
+      fader_control_binding_(nullptr),
       timer_fader_fudge_(new QTimer(this)),
       timer_fader_timeout_(new QTimer(this)),
       pipeline_(nullptr),
@@ -191,6 +197,12 @@ GstEnginePipeline::~GstEnginePipeline() {
 
   Disconnect();
 
+  if (fader_control_source_) {
+    gst_object_unref(fader_control_source_);
+    fader_control_source_ = nullptr;
+    fader_control_binding_ = nullptr;
+  }
+
   if (pipeline_) {
 
     gst_element_set_state(pipeline_, GST_STATE_NULL);
@@ -429,17 +441,9 @@ bool GstEnginePipeline::Finish() {
 
 }
 
-bool GstEnginePipeline::InitFromUrl(const QUrl &media_url, const QUrl &stream_url, const QByteArray &gst_url, const qint64 end_nanosec, const double ebur128_loudness_normalizing_gain_db, QString &error) {
-
-  {
-    QMutexLocker l(&mutex_url_);
-    media_url_ = media_url;
-    stream_url_ = stream_url;
-    gst_url_ = gst_url;
-  }
+bool GstEnginePipeline::InitPipeline(QString &error) {
 
-  end_offset_nanosec_ = end_nanosec;
-  ebur128_loudness_normalizing_gain_db_ = ebur128_loudness_normalizing_gain_db;
+  if (pipeline_) return true;
 
   guint version_major = 0, version_minor = 0, version_micro = 0, version_nano = 0;
   gst_plugins_base_version(&version_major, &version_minor, &version_micro, &version_nano);
@@ -485,9 +489,27 @@ bool GstEnginePipeline::InitFromUrl(const QUrl &media_url, const QUrl &stream_ur
   flags &= ~GST_PLAY_FLAG_SOFT_VOLUME;
   g_object_set(G_OBJECT(pipeline_), "flags", flags, nullptr);
 
+  return true;
+
+}
+
+bool GstEnginePipeline::InitFromUrl(const QUrl &media_url, const QUrl &stream_url, const QByteArray &gst_url, const qint64 end_nanosec, const double ebur128_loudness_normalizing_gain_db, QString &error) {
+
   {
     QMutexLocker l(&mutex_url_);
-    g_object_set(G_OBJECT(pipeline_), "uri", gst_url.constData(), nullptr);
+    media_url_ = media_url;
+    stream_url_ = stream_url;
+    gst_url_ = gst_url;
+  }
+
+  end_offset_nanosec_ = end_nanosec;
+  ebur128_loudness_normalizing_gain_db_ = ebur128_loudness_normalizing_gain_db;
+
+  if (!InitPipeline(error)) return false;
+
+  {
+    QMutexLocker l(&mutex_url_);
+    g_object_set(G_OBJECT(pipeline_), "uri", gst_url_.constData(), nullptr);
   }
 
   pipeline_connected_ = true;
@@ -1729,7 +1751,7 @@ void GstEnginePipeline::BufferingMessageReceived(GstMessage *msg) {
   else if (percent == 100 && buffering_.value()) {
     qLog(Debug) << "Buffering finished";
     buffering_ = false;
-    Q_EMIT BufferingFinished();
+    Q_EMIT BufferingFinished(id());
     if (pending_seek_nanosec_.value() != -1 && !next_uri_need_reset_.value()) {
       ProcessPendingSeek(state());
     }
@@ -1995,6 +2017,20 @@ void GstEnginePipeline::UpdateEqualizer() {
 
   g_object_set(G_OBJECT(equalizer_preamp_), "volume", preamp, nullptr);
 
+  // With the equalizer disabled or every band at zero the filter would compute identity;
+  // put the element into passthrough so buffers skip it entirely. The preamp is a volume
+  // element, which already short-circuits itself at unity.
+  bool neutral = true;
+  if (eq_enabled_) {
+    for (int i = 0; i < kEqBandCount; ++i) {
+      if (eq_band_gains_.value(i) != 0) {
+        neutral = false;
+        break;
+      }
+    }
+  }
+  gst_base_transform_set_passthrough(GST_BASE_TRANSFORM(equalizer_), neutral);
+
 }
 
 void GstEnginePipeline::SetEBUR128LoudnessNormalizingGain_dB(const double ebur128_loudness_normalizing_gain_db) {
@@ -2039,7 +2075,6 @@ void GstEnginePipeline::StartFader(const qint64 duration_nanosec, const QTimeLin
     }
     timeline->deleteLater();
   });
-  QObject::connect(&*fader_, &QTimeLine::valueChanged, this, &GstEnginePipeline::SetFaderVolume);
   QObject::connect(&*fader_, &QTimeLine::stateChanged, this, &GstEnginePipeline::FaderTimelineStateChanged);
   QObject::connect(&*fader_, &QTimeLine::finished, this, &GstEnginePipeline::FaderTimelineFinished);
   fader_->setDirection(direction);
@@ -2052,7 +2087,11 @@ void GstEnginePipeline::StartFader(const qint64 duration_nanosec, const QTimeLin
   timer_fader_fudge_->stop();
   fader_use_fudge_timer_ = use_fudge_timer;
 
-  SetFaderVolume(fader_->currentValue());
+  // Prefer ramping the volume natively inside GStreamer, falling back to stepping it from the timeline ticks.
+  if (!SetupFaderRamp(duration_nanosec, direction, shape, start_time)) {
+    QObject::connect(&*fader_, &QTimeLine::valueChanged, this, &GstEnginePipeline::SetFaderVolume);
+    SetFaderVolume(fader_->currentValue());
+  }
 
   qLog(Debug) << "Pipeline" << id() << "with state" << GstStateText(state()) << "set to fade from" << fader_->currentValue() << "time" << start_time << "direction" << (direction == QTimeLine::Direction::Forward ? "forward" : "backward");
 
@@ -2070,6 +2109,62 @@ void GstEnginePipeline::SetFaderVolume(const qreal volume) {
 
 }
 
+bool GstEnginePipeline::SetupFaderRamp(const qint64 duration_nanosec, const QTimeLine::Direction direction, const QEasingCurve::Type shape, const qint64 start_time_msec) {
+
+  if (!volume_fading_ || !pipeline_) return false;
+
+  const qint64 duration_msec = duration_nanosec / kNsecPerMsec;
+  const qint64 remaining_msec = direction == QTimeLine::Direction::Forward ? duration_msec - start_time_msec : start_time_msec;
+  if (duration_msec <= 0 || remaining_msec < 0) return false;
+
+  if (!fader_control_source_) {
+    fader_control_source_ = GST_CONTROL_SOURCE(gst_interpolation_control_source_new());
+    g_object_set(G_OBJECT(fader_control_source_), "mode", GST_INTERPOLATION_MODE_LINEAR, nullptr);
+    fader_control_binding_ = gst_direct_control_binding_new_absolute(GST_OBJECT(volume_fading_), "volume", fader_control_source_);
+    if (!fader_control_binding_ || !gst_object_add_control_binding(GST_OBJECT(volume_fading_), fader_control_binding_)) {
+      gst_object_unref(fader_control_source_);
+      fader_control_source_ = nullptr;
+      fader_control_binding_ = nullptr;
+      return false;
+    }
+  }
+
+  GstTimedValueControlSource *control_source = GST_TIMED_VALUE_CONTROL_SOURCE(fader_control_source_);
+  gst_timed_value_control_source_unset_all(control_source);
+
+  GstClockTime base_time = 0;
+  if (pipeline_active_.value()) {
+    base_time = gst_element_get_current_running_time(pipeline_);
+    if (!GST_CLOCK_TIME_IS_VALID(base_time)) base_time = 0;
+  }
+
+  // Sample the easing curve into linear segments over the remaining fade time,
+  // so the ramp is applied per audio buffer by the volume element instead of per timer tick.
+  constexpr int kRampPoints = 32;
+  for (int i = 0; i <= kRampPoints; ++i) {
+    const qint64 elapsed_msec = remaining_msec * i / kRampPoints;
+    const qint64 timeline_msec = direction == QTimeLine::Direction::Forward ? start_time_msec + elapsed_msec : start_time_msec - elapsed_msec;
+    const gdouble value = fader_->easingCurve().valueForProgress(static_cast<qreal>(timeline_msec) / static_cast<qreal>(duration_msec));
+    gst_timed_value_control_source_set(control_source, base_time + static_cast<GstClockTime>(elapsed_msec) * GST_MSECOND, value);
+  }
+
+  Q_UNUSED(shape)
+
+  return true;
+
+}
+
+void GstEnginePipeline::RemoveFaderRamp(const double final_volume) {
+
+  if (!fader_control_source_) return;
+
+  GstTimedValueControlSource *control_source = GST_TIMED_VALUE_CONTROL_SOURCE(fader_control_source_);
+  gst_timed_value_control_source_unset_all(control_source);
+  // The binding overrides the property, so the reached volume is kept as a single flat control point.
+  gst_timed_value_control_source_set(control_source, 0, final_volume);
+
+}
+
 void GstEnginePipeline::ResumeFaderAsync() {
 
   if (fader_active_.value() && !fader_running_.value()) {
@@ -2106,8 +2201,14 @@ void GstEnginePipeline::FaderTimelineTimeout() {
   qLog(Debug) << "Pipeline" << id() << "fading timed out";
 
   if (volume_fading_) {
-    qLog(Debug) << "Pipeline" << id() << "setting volume" << (fader_->direction() == QTimeLine::Direction::Forward ? 1.0 : 0.0);
-    g_object_set(G_OBJECT(volume_fading_), "volume", fader_->direction() == QTimeLine::Direction::Forward ? 1.0 : 0.0, nullptr);
+    const double final_volume = fader_->direction() == QTimeLine::Direction::Forward ? 1.0 : 0.0;
+    qLog(Debug) << "Pipeline" << id() << "setting volume" << final_volume;
+    if (fader_control_source_) {
+      RemoveFaderRamp(final_volume);
+    }
+    else {
+      g_object_set(G_OBJECT(volume_fading_), "volume", final_volume, nullptr);
+    }
   }
 
   FaderTimelineFinished();
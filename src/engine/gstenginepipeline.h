@@ -83,6 +83,8 @@ class GstEnginePipeline : public QObject {
   bool Finish();
 
   // Creates the pipeline, returns false on error
+  // Builds the element graph without a URL so a standby pipeline can be pre-rolled ahead of track start. Safe to call twice.
+  bool InitPipeline(QString &error);
   bool InitFromUrl(const QUrl &media_url, const QUrl &stream_url, const QByteArray &gst_url, const qint64 end_nanosec, const double ebur128_loudness_normalizing_gain_db, QString &error);
 
   // GstBufferConsumers get fed audio data.  Thread-safe.
@@ -152,7 +154,7 @@ class GstEnginePipeline : public QObject {
   void FaderFinished(const int pipeline_id);
   void BufferingStarted();
   void BufferingProgress(const int percent);
-  void BufferingFinished();
+  void BufferingFinished(const int pipeline_id);
 
  private:
   static QString GstStateText(const GstState state);
@@ -199,6 +201,14 @@ class GstEnginePipeline : public QObject {
  private Q_SLOTS:
   void SetStateFinishedSlot(const GstState state, const GstStateChangeReturn state_change_return);
   void SetFaderVolume(const qreal volume);
+
+ private:
+  // Programs the fade as control points on the fading volume element so GStreamer applies it sample-accurately.
+  // Returns false when no control binding could be set up, in which case the timeline drives the volume per tick.
+  bool SetupFaderRamp(const qint64 duration_nanosec, const QTimeLine::Direction direction, const QEasingCurve::Type shape, const qint64 start_time_msec);
+  void RemoveFaderRamp(const double final_volume);
+
+ private Q_SLOTS:
   void FaderTimelineStateChanged(const QTimeLine::State state);
   void FaderTimelineFinished();
   void FaderTimelineTimeout();
@@ -336,6 +346,8 @@ class GstEnginePipeline : public QObject {
   mutex_protected<bool> fader_running_;
   bool fader_use_fudge_timer_;
   SharedPtr<QTimeLine> fader_;
+  GstControlSource *fader_control_source_;
+  GstControlBinding *fader_control_binding_;
   QTimer *timer_fader_fudge_;
   QTimer *timer_fader_timeout_;
 
@@ -263,16 +263,25 @@ static gboolean gst_strawberry_fastspectrum_stop(GstBaseTransform *transform) {
 
 // Mixing data readers
 
+// The ring buffer is filled in at most two contiguous runs instead of taking a modulo per sample,
+// so the inner loops are plain contiguous conversions the compiler can vectorize.
+
 static void gst_strawberry_fastspectrum_input_data_mixed_float(const guint8 *_in, double *out, const guint64 len, const double max_value, guint op, const guint nfft) {
 
   (void) max_value;
 
   const gfloat *in = reinterpret_cast<const gfloat*>(_in);
-  guint ip = 0;
+  guint64 remaining = len;
+  guint64 ip = 0;
 
-  for (guint64 j = 0; j < len; j++) {
-    out[op] = in[ip++];
-    op = (op + 1) % nfft;
+  while (remaining > 0) {
+    const guint64 chunk = MIN(remaining, static_cast<guint64>(nfft - op));
+    for (guint64 j = 0; j < chunk; j++) {
+      out[op + j] = in[ip + j];
+    }
+    ip += chunk;
+    op = static_cast<guint>((op + chunk) % nfft);
+    remaining -= chunk;
   }
 
 }
@@ -282,11 +291,15 @@ static void gst_strawberry_fastspectrum_input_data_mixed_double(const guint8 *_i
   (void) max_value;
 
   const gdouble *in = reinterpret_cast<const gdouble*>(_in);
-  guint ip = 0;
-
-  for (guint64 j = 0; j < len; j++) {
-    out[op] = in[ip++];
-    op = (op + 1) % nfft;
+  guint64 remaining = len;
+  guint64 ip = 0;
+
+  while (remaining > 0) {
+    const guint64 chunk = MIN(remaining, static_cast<guint64>(nfft - op));
+    memcpy(out + op, in + ip, chunk * sizeof(double));
+    ip += chunk;
+    op = static_cast<guint>((op + chunk) % nfft);
+    remaining -= chunk;
   }
 
 }
@@ -294,30 +307,42 @@ static void gst_strawberry_fastspectrum_input_data_mixed_double(const guint8 *_i
 static void gst_strawberry_fastspectrum_input_data_mixed_int32_max(const guint8 *_in, double *out, const guint64 len, const double max_value, guint op, const guint nfft) {
 
   const gint32 *in = reinterpret_cast<const gint32*>(_in);
-  guint ip = 0;
+  guint64 remaining = len;
+  guint64 ip = 0;
 
-  for (guint64 j = 0; j < len; j++) {
-    out[op] = in[ip++] / max_value;
-    op = (op + 1) % nfft;
+  while (remaining > 0) {
+    const guint64 chunk = MIN(remaining, static_cast<guint64>(nfft - op));
+    for (guint64 j = 0; j < chunk; j++) {
+      out[op + j] = in[ip + j] / max_value;
+    }
+    ip += chunk;
+    op = static_cast<guint>((op + chunk) % nfft);
+    remaining -= chunk;
   }
 
 }
 
 static void gst_strawberry_fastspectrum_input_data_mixed_int24_max(const guint8 *_in, double *out, const guint64 len, const double max_value, guint op, const guint nfft) {
 
-  for (guint64 j = 0; j < len; j++) {
+  guint64 remaining = len;
+
+  while (remaining > 0) {
+    const guint64 chunk = MIN(remaining, static_cast<guint64>(nfft - op));
+    for (guint64 j = 0; j < chunk; j++) {
 #if G_BYTE_ORDER == G_BIG_ENDIAN
-    guint32 value = GST_READ_UINT24_BE(_in);
+      guint32 value = GST_READ_UINT24_BE(_in);
 #else
-    guint32 value = GST_READ_UINT24_LE(_in);
+      guint32 value = GST_READ_UINT24_LE(_in);
 #endif
-    if (value & 0x00800000) {
-      value |= 0xff000000;
-    }
+      if (value & 0x00800000) {
+        value |= 0xff000000;
+      }
 
-    out[op] = value / max_value;
-    op = (op + 1) % nfft;
-    _in += 3;
+      out[op + j] = value / max_value;
+      _in += 3;
+    }
+    op = static_cast<guint>((op + chunk) % nfft);
+    remaining -= chunk;
   }
 
 }
@@ -325,11 +350,17 @@ static void gst_strawberry_fastspectrum_input_data_mixed_int24_max(const guint8
 static void gst_strawberry_fastspectrum_input_data_mixed_int16_max(const guint8 *_in, double *out, const guint64 len, const double max_value, guint op, const guint nfft) {
 
   const gint16 *in = reinterpret_cast<const gint16*>(_in);
-  guint ip = 0;
+  guint64 remaining = len;
+  guint64 ip = 0;
 
-  for (guint64 j = 0; j < len; j++) {
-    out[op] = in[ip++] / max_value;
-    op = (op + 1) % nfft;
+  while (remaining > 0) {
+    const guint64 chunk = MIN(remaining, static_cast<guint64>(nfft - op));
+    for (guint64 j = 0; j < chunk; j++) {
+      out[op + j] = in[ip + j] / max_value;
+    }
+    ip += chunk;
+    op = static_cast<guint>((op + chunk) % nfft);
+    remaining -= chunk;
   }
 
 }
@@ -374,19 +405,20 @@ static void gst_strawberry_fastspectrum_run_fft(GstStrawberryFastSpectrum *fasts
   const guint bands = fastspectrum->bands;
   const guint nfft = 2 * bands - 2;
 
-  for (guint i = 0; i < nfft; i++) {
-    fastspectrum->fft_input[i] = fastspectrum->input_ring_buffer[(input_pos + i) % nfft];
-  }
+  // Unroll the ring buffer into the FFT input in two contiguous copies.
+  const guint tail = nfft - input_pos;
+  memcpy(fastspectrum->fft_input, fastspectrum->input_ring_buffer + input_pos, tail * sizeof(double));
+  memcpy(fastspectrum->fft_input + tail, fastspectrum->input_ring_buffer, input_pos * sizeof(double));
 
   // Should be safe to execute the same plan multiple times in parallel.
   fftw_execute(fastspectrum->plan);
 
   // Calculate magnitude in db
+  const gdouble scale = 1.0 / (static_cast<gdouble>(nfft) * static_cast<gdouble>(nfft));
   for (guint i = 0; i < bands; i++) {
     gdouble value = fastspectrum->fft_output[i][0] * fastspectrum->fft_output[i][0];
     value += fastspectrum->fft_output[i][1] * fastspectrum->fft_output[i][1];
-    value /= nfft * nfft;
-    fastspectrum->spect_magnitude[i] += value;
+    fastspectrum->spect_magnitude[i] += value * scale;
   }
 
 }
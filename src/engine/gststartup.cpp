@@ -38,6 +38,8 @@
 #  include "gstfastspectrumplugin.h"
 #endif
 
+#include <QtConcurrentRun>
+
 #include "gststartup.h"
 
 using namespace Qt::Literals::StringLiterals;
@@ -75,6 +77,20 @@ void Initialize() {
   }
 #endif
 
+  // Force-load the plugins behind the elements every pipeline needs, off the main thread,
+  // so the first track start doesn't pay the plugin scanner and .so loading.
+  (void)QtConcurrent::run([]() {
+    static const char *kPreloadFactories[] = { "playbin3", "playbin", "audioconvert", "audioresample", "volume", "equalizer-nbands", "autoaudiosink", "decodebin" };
+    for (const char *factory_name : kPreloadFactories) {
+      if (GstElementFactory *factory = gst_element_factory_find(factory_name)) {
+        // Loading the feature pulls its plugin in.
+        GstPluginFeature *loaded_feature = gst_plugin_feature_load(GST_PLUGIN_FEATURE(factory));
+        if (loaded_feature) gst_object_unref(loaded_feature);
+        gst_object_unref(factory);
+      }
+    }
+  });
+
 }
 
 void SetEnvironment() {
@@ -20,6 +20,8 @@
 
 #include "config.h"
 
+#include <chrono>
+
 #include <algorithm>
 
 #include <QtGlobal>
@@ -35,6 +37,7 @@
 #include <QLineEdit>
 #include <QShortcut>
 #include <QSlider>
+#include <QTimer>
 #include <QMessageBox>
 #include <QInputDialog>
 #include <QToolButton>
@@ -50,6 +53,7 @@
 #include "ui_equalizer.h"
 
 using namespace Qt::Literals::StringLiterals;
+using namespace std::chrono_literals;
 
 namespace {
 constexpr char kSettingsGroup[] = "Equalizer";
@@ -59,10 +63,15 @@ const char *kGainText[] = { "60", "170", "310", "600", "1k", "3k", "6k", "12k",
 Equalizer::Equalizer(QWidget *parent)
     : QDialog(parent),
       ui_(new Ui_Equalizer),
+      timer_save_(new QTimer(this)),
       loading_(false) {
 
   ui_->setupUi(this);
 
+  timer_save_->setSingleShot(true);
+  timer_save_->setInterval(500ms);
+  QObject::connect(timer_save_, &QTimer::timeout, this, &Equalizer::SaveNow);
+
   // Icons
   ui_->preset_del->setIcon(IconLoader::Load(u"list-remove"_s));
   ui_->preset_save->setIcon(IconLoader::Load(u"document-save"_s));
@@ -94,6 +103,10 @@ Equalizer::Equalizer(QWidget *parent)
 }
 
 Equalizer::~Equalizer() {
+  if (timer_save_->isActive()) {
+    timer_save_->stop();
+    SaveNow();
+  }
   delete ui_;
 }
 
@@ -327,6 +340,13 @@ void Equalizer::EqualizerParametersChangedSlot() {
 
 void Equalizer::Save() {
 
+  // Slider drags call this per tick, coalesce the writes and flush shortly after the last change.
+  timer_save_->start();
+
+}
+
+void Equalizer::SaveNow() {
+
   Settings s;
   s.beginGroup(kSettingsGroup);
 
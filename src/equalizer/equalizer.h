@@ -35,6 +35,7 @@ class QWidget;
 class QCloseEvent;
 
 class EqualizerSlider;
+class QTimer;
 class Ui_Equalizer;
 
 class Equalizer : public QDialog {
@@ -83,6 +84,7 @@ class Equalizer : public QDialog {
   void SavePreset();
   void DelPreset();
   void Save();
+  void SaveNow();
 
  private:
   EqualizerSlider *AddSlider(const QString &label);
@@ -93,6 +95,7 @@ class Equalizer : public QDialog {
 
  private:
   Ui_Equalizer *ui_;
+  QTimer *timer_save_;
   bool loading_;
 
   QString last_preset_;
@@ -22,6 +22,7 @@
 
 #include <QWidget>
 #include <QUndoStack>
+#include <QTimer>
 #include <QDir>
 #include <QFileInfo>
 #include <QFileSystemModel>
@@ -175,10 +176,33 @@ void FileView::ChangeFilePathWithoutUndo(const QString &new_path) {
   QDir dir(new_path);
   ui_->up->setEnabled(dir.cdUp());
 
+  // Prefetch the listings of the subdirectories shortly after showing this one, so stepping into any of them is instant.
+  QTimer::singleShot(200, this, &FileView::PrefetchSubdirectories);
+
   Q_EMIT PathChanged(new_path);
 
 }
 
+void FileView::PrefetchSubdirectories() {
+
+  if (!model_) return;
+
+  const QModelIndex root_index = ui_->list->rootIndex();
+  if (!root_index.isValid()) return;
+
+  constexpr int kMaxPrefetchDirectories = 50;
+  int prefetched = 0;
+  const int row_count = model_->rowCount(root_index);
+  for (int row = 0; row < row_count && prefetched < kMaxPrefetchDirectories; ++row) {
+    const QModelIndex child_index = model_->index(row, 0, root_index);
+    if (model_->isDir(child_index) && model_->canFetchMore(child_index)) {
+      model_->fetchMore(child_index);
+      ++prefetched;
+    }
+  }
+
+}
+
 void FileView::ItemActivated(const QModelIndex &idx) {
   if (model_->isDir(idx))
     ChangeFilePath(model_->filePath(idx));
@@ -71,6 +71,7 @@ class FileView : public QWidget {
   void EditTags(const QList<QUrl> &urls);
 
  private Q_SLOTS:
+  void PrefetchSubdirectories();
   void FileUp();
   void FileHome();
   void ChangeFilePath(const QString &new_path);
@@ -0,0 +1,140 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "config.h"
+
+#include <QString>
+#include <QStringList>
+#include <QRegularExpression>
+
+#include "core/song.h"
+#include "filtertosql.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace {
+
+QString EscapeSqlLiteral(QString value) {
+
+  value.replace(u'\'', "''"_L1);
+  return value;
+
+}
+
+QString EscapeLikeValue(QString value) {
+
+  value.replace(u'\\', "\\\\"_L1);
+  value.replace(u'%', "\\%"_L1);
+  value.replace(u'_', "\\_"_L1);
+  return EscapeSqlLiteral(value);
+
+}
+
+QString TextContainsCondition(const QString &column, const QString &value) {
+  return QStringLiteral("%1 LIKE '%%2%' ESCAPE '\\'").arg(column, EscapeLikeValue(value));
+}
+
+}  // namespace
+
+namespace FilterToSql {
+
+std::optional<QString> Compile(const QString &filter_string) {
+
+  // Only conjunctions of terms are pushed down.
+  if (filter_string.contains(u'(') || filter_string.contains(u')') || filter_string.contains(u'"') || filter_string.contains("OR"_L1)) {
+    return std::nullopt;
+  }
+
+  // SQLite's LIKE is only case-insensitive for ASCII, keep non-ASCII searches on the in-memory path so their semantics don't change.
+  for (const QChar &ch : filter_string) {
+    if (ch.unicode() > 127) return std::nullopt;
+  }
+
+  static const QRegularExpression regex_whitespace(u"\\s+"_s);
+  const QStringList tokens = filter_string.split(regex_whitespace, Qt::SkipEmptyParts);
+  if (tokens.isEmpty()) return std::nullopt;
+
+  QStringList conditions;
+  for (const QString &token : tokens) {
+
+    // FilterParser negates "-term"; LIKE '%-term%' would be a positive literal match, leave exclusions to the filter tree.
+    if (token.startsWith(u'-')) return std::nullopt;
+
+    const qint64 idx_colon = token.indexOf(u':');
+    if (idx_colon > 0 && idx_colon < token.length() - 1) {
+
+      QString field = token.left(idx_colon).toLower();
+      QString value = token.mid(idx_colon + 1);
+
+      QString op;
+      for (const QString &prefix : { u"<="_s, u">="_s, u"<>"_s, u"!="_s, u"=="_s, u"="_s, u"<"_s, u">"_s }) {
+        if (value.startsWith(prefix)) {
+          op = prefix;
+          value = value.mid(prefix.length());
+          break;
+        }
+      }
+      if (value.isEmpty()) return std::nullopt;
+
+      if (Song::kTextSearchColumns.contains(field, Qt::CaseInsensitive)) {
+        if (field == "filename"_L1) field = u"url"_s;
+        if (op.isEmpty()) {
+          conditions << TextContainsCondition(field, value);
+        }
+        else if (op == "="_L1 || op == "=="_L1) {
+          conditions << QStringLiteral("%1 LIKE '%2' ESCAPE '\\'").arg(field, EscapeLikeValue(value));
+        }
+        else if (op == "!="_L1 || op == "<>"_L1) {
+          conditions << QStringLiteral("%1 NOT LIKE '%2' ESCAPE '\\'").arg(field, EscapeLikeValue(value));
+        }
+        else {
+          return std::nullopt;
+        }
+      }
+      else if (Song::kIntSearchColumns.contains(field, Qt::CaseInsensitive) || Song::kUIntSearchColumns.contains(field, Qt::CaseInsensitive)) {
+        bool ok = false;
+        const qint64 number = value.toLongLong(&ok);
+        if (!ok) return std::nullopt;
+        if (op.isEmpty() || op == "=="_L1) op = u"="_s;
+        else if (op == "!="_L1) op = u"<>"_s;
+        conditions << QStringLiteral("%1 %2 %3").arg(field, op, QString::number(number));
+      }
+      else {
+        // length uses human readable formats and rating has its own scale, leave those to the filter tree.
+        return std::nullopt;
+      }
+
+    }
+    else {
+      // A plain term matches when any text column contains it.
+      QStringList term_conditions;
+      for (const QString &column : Song::kTextSearchColumns) {
+        if (column == "filename"_L1) continue;
+        term_conditions << TextContainsCondition(column, token);
+      }
+      conditions << QLatin1Char('(') + term_conditions.join(" OR "_L1) + QLatin1Char(')');
+    }
+
+  }
+
+  return QLatin1Char('(') + conditions.join(" AND "_L1) + QLatin1Char(')');
+
+}
+
+}  // namespace FilterToSql
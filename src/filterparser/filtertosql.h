@@ -0,0 +1,39 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FILTERTOSQL_H
+#define FILTERTOSQL_H
+
+#include "config.h"
+
+#include <optional>
+
+#include <QString>
+
+namespace FilterToSql {
+
+// Compiles a filter string of the form FilterParser accepts into a SQL WHERE clause over the songs table,
+// so the database can resolve the matching songs in one indexed query instead of evaluating the filter tree per song.
+// Only conjunctions of plain search terms and field terms on text and integer columns are supported;
+// returns std::nullopt for anything else (OR, parentheses, quoted phrases, length, rating), which keeps the in-memory path authoritative.
+std::optional<QString> Compile(const QString &filter_string);
+
+}  // namespace FilterToSql
+
+#endif  // FILTERTOSQL_H
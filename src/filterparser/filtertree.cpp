@@ -30,28 +30,64 @@ using namespace Qt::Literals::StringLiterals;
 FilterTree::FilterTree() = default;
 FilterTree::~FilterTree() = default;
 
+FilterTree::Column FilterTree::ColumnFromName(const QString &column) {
+
+  if (column == "albumartist"_L1) return Column::AlbumArtist;
+  if (column == "artist"_L1)      return Column::Artist;
+  if (column == "album"_L1)       return Column::Album;
+  if (column == "title"_L1)       return Column::Title;
+  if (column == "composer"_L1)    return Column::Composer;
+  if (column == "performer"_L1)   return Column::Performer;
+  if (column == "grouping"_L1)    return Column::Grouping;
+  if (column == "genre"_L1)       return Column::Genre;
+  if (column == "comment"_L1)     return Column::Comment;
+  if (column == "track"_L1)       return Column::Track;
+  if (column == "year"_L1)        return Column::Year;
+  if (column == "length"_L1)      return Column::Length;
+  if (column == "samplerate"_L1)  return Column::Samplerate;
+  if (column == "bitdepth"_L1)    return Column::Bitdepth;
+  if (column == "bitrate"_L1)     return Column::Bitrate;
+  if (column == "rating"_L1)      return Column::Rating;
+  if (column == "playcount"_L1)   return Column::Playcount;
+  if (column == "skipcount"_L1)   return Column::Skipcount;
+  if (column == "filename"_L1)    return Column::Filename;
+  if (column == "url"_L1)         return Column::Url;
+
+  return Column::Invalid;
+
+}
+
 QVariant FilterTree::DataFromColumn(const QString &column, const Song &metadata) {
 
-  if (column == "albumartist"_L1) return metadata.effective_albumartist();
-  if (column == "artist"_L1)      return metadata.artist();
-  if (column == "album"_L1)       return metadata.album();
-  if (column == "title"_L1)       return metadata.PrettyTitle();
-  if (column == "composer"_L1)    return metadata.composer();
-  if (column == "performer"_L1)   return metadata.performer();
-  if (column == "grouping"_L1)    return metadata.grouping();
-  if (column == "genre"_L1)       return metadata.genre();
-  if (column == "comment"_L1)     return metadata.comment();
-  if (column == "track"_L1)       return metadata.track();
-  if (column == "year"_L1)        return metadata.year();
-  if (column == "length"_L1)      return metadata.length_nanosec();
-  if (column == "samplerate"_L1)  return metadata.samplerate();
-  if (column == "bitdepth"_L1)    return metadata.bitdepth();
-  if (column == "bitrate"_L1)     return metadata.bitrate();
-  if (column == "rating"_L1)      return metadata.rating();
-  if (column == "playcount"_L1)   return metadata.playcount();
-  if (column == "skipcount"_L1)   return metadata.skipcount();
-  if (column == "filename"_L1)    return metadata.basefilename();
-  if (column == "url"_L1)         return metadata.effective_stream_url().toString();
+  return DataFromColumn(ColumnFromName(column), metadata);
+
+}
+
+QVariant FilterTree::DataFromColumn(const Column column, const Song &metadata) {
+
+  switch (column) {
+    case Column::AlbumArtist: return metadata.effective_albumartist();
+    case Column::Artist:      return metadata.artist();
+    case Column::Album:       return metadata.album();
+    case Column::Title:       return metadata.PrettyTitle();
+    case Column::Composer:    return metadata.composer();
+    case Column::Performer:   return metadata.performer();
+    case Column::Grouping:    return metadata.grouping();
+    case Column::Genre:       return metadata.genre();
+    case Column::Comment:     return metadata.comment();
+    case Column::Track:       return metadata.track();
+    case Column::Year:        return metadata.year();
+    case Column::Length:      return metadata.length_nanosec();
+    case Column::Samplerate:  return metadata.samplerate();
+    case Column::Bitdepth:    return metadata.bitdepth();
+    case Column::Bitrate:     return metadata.bitrate();
+    case Column::Rating:      return metadata.rating();
+    case Column::Playcount:   return metadata.playcount();
+    case Column::Skipcount:   return metadata.skipcount();
+    case Column::Filename:    return metadata.basefilename();
+    case Column::Url:         return metadata.effective_stream_url().toString();
+    case Column::Invalid:     break;
+  }
 
   return QVariant();
 
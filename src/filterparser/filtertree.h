@@ -44,8 +44,36 @@ class FilterTree {
 
   virtual bool accept(const Song &song) const = 0;
 
+  // Filter columns resolved once at parse time so per-song evaluation is a switch instead of a string comparison chain.
+  enum class Column {
+    Invalid = 0,
+    AlbumArtist,
+    Artist,
+    Album,
+    Title,
+    Composer,
+    Performer,
+    Grouping,
+    Genre,
+    Comment,
+    Track,
+    Year,
+    Length,
+    Samplerate,
+    Bitdepth,
+    Bitrate,
+    Rating,
+    Playcount,
+    Skipcount,
+    Filename,
+    Url
+  };
+
+  static Column ColumnFromName(const QString &column);
+
  protected:
   static QVariant DataFromColumn(const QString &column, const Song &metadata);
+  static QVariant DataFromColumn(const Column column, const Song &metadata);
 
  private:
   Q_DISABLE_COPY(FilterTree)
@@ -24,7 +24,7 @@
 #include "filtertreecolumnterm.h"
 #include "filterparsersearchtermcomparator.h"
 
-FilterTreeColumnTerm::FilterTreeColumnTerm(const QString &column, FilterParserSearchTermComparator *comparator) : column_(column), cmp_(comparator) {}
+FilterTreeColumnTerm::FilterTreeColumnTerm(const QString &column, FilterParserSearchTermComparator *comparator) : column_(ColumnFromName(column)), cmp_(comparator) {}
 
 bool FilterTreeColumnTerm::accept(const Song &song) const {
   return cmp_->Matches(DataFromColumn(column_, song));
@@ -39,7 +39,7 @@ class FilterTreeColumnTerm : public FilterTree {
   bool accept(const Song &song) const override;
 
  private:
-  const QString column_;
+  const Column column_;
   QScopedPointer<FilterParserSearchTermComparator> cmp_;
 
   Q_DISABLE_COPY(FilterTreeColumnTerm)
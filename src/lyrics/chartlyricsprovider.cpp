@@ -84,13 +84,13 @@ void ChartLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int id,
 
   if (reply->error() != QNetworkReply::NoError) {
     Error(QStringLiteral("%1 (%2)").arg(reply->errorString()).arg(reply->error()));
-    Q_EMIT SearchFinished(id);
+    Q_EMIT SearchFinished(id, LyricsSearchResults(), true);
     return;
   }
 
   if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() != 200) {
     Error(QStringLiteral("Received HTTP code %1").arg(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt()));
-    Q_EMIT SearchFinished(id);
+    Q_EMIT SearchFinished(id, LyricsSearchResults(), true);
     return;
   }
 
@@ -65,11 +65,12 @@ class GeniusLyricsProvider : public JsonLyricsProvider {
     QUrl url;
   };
   struct GeniusLyricsSearchContext {
-    explicit GeniusLyricsSearchContext() : id(-1) {}
+    explicit GeniusLyricsSearchContext() : id(-1), error(false) {}
     int id;
     LyricsSearchRequest request;
     QMap<QUrl, GeniusLyricsLyricContext> requests_lyric_;
     LyricsSearchResults results;
+    bool error;
   };
 
   using GeniusLyricsSearchContextPtr = SharedPtr<GeniusLyricsSearchContext>;
@@ -87,7 +87,7 @@ void LoloLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int id, c
     failure_reason = QStringLiteral("%1 (%2)").arg(reply->errorString()).arg(reply->error());
     if (reply->error() < 200) {
       Error(failure_reason);
-      Q_EMIT SearchFinished(id);
+      Q_EMIT SearchFinished(id, LyricsSearchResults(), true);
       return;
     }
   }
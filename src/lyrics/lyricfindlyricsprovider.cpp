@@ -106,10 +106,12 @@ void LyricFindLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int
   reply->deleteLater();
 
   LyricsSearchResults results;
-  const QScopeGuard end_search = qScopeGuard([this, id, request, &results]() { EndSearch(id, request, results); });
+  bool error = false;
+  const QScopeGuard end_search = qScopeGuard([this, id, request, &results, &error]() { EndSearch(id, request, results, error); });
 
   if (reply->error() != QNetworkReply::NoError) {
     Error(QStringLiteral("%1 (%2)").arg(reply->errorString()).arg(reply->error()));
+    error = true;
     return;
   }
 
@@ -117,6 +119,7 @@ void LyricFindLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int
     const int http_code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
     if (http_code != 200 && http_code != 201 && http_code != 202) {
       Error(QStringLiteral("Received HTTP code %1").arg(http_code));
+      error = true;
       return;
     }
   }
@@ -124,12 +127,14 @@ void LyricFindLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int
   const QByteArray data = reply->readAll();
   if (data.isEmpty()) {
     Error(u"Empty reply received from server."_s);
+    error = true;
     return;
   }
 
   const QString content = QString::fromUtf8(data);
   if (content.isEmpty()) {
     Error(u"Empty reply received from server."_s);
+    error = true;
     return;
   }
 
@@ -206,7 +211,7 @@ void LyricFindLyricsProvider::Error(const QString &error, const QVariant &debug)
 
 }
 
-void LyricFindLyricsProvider::EndSearch(const int id, const LyricsSearchRequest &request, const LyricsSearchResults &results) {
+void LyricFindLyricsProvider::EndSearch(const int id, const LyricsSearchRequest &request, const LyricsSearchResults &results, const bool error) {
 
   if (results.isEmpty()) {
     qLog(Debug) << "LyricFind: No lyrics for" << request.artist << request.title;
@@ -215,6 +220,6 @@ void LyricFindLyricsProvider::EndSearch(const int id, const LyricsSearchRequest
     qLog(Debug) << "LyricFind: Got lyrics for" << request.artist << request.title;
   }
 
-  Q_EMIT SearchFinished(id, results);
+  Q_EMIT SearchFinished(id, results, error);
 
 }
@@ -27,6 +27,12 @@
 
 #include "includes/shared_ptr.h"
 #include "core/song.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDateTime>
+#include <QStandardPaths>
+#include <QCryptographicHash>
 #include "lyricsfetcher.h"
 #include "lyricsfetchersearch.h"
 #include "lyricssearchrequest.h"
@@ -57,6 +63,37 @@ quint64 LyricsFetcher::Search(const QString &effective_albumartist, const QStrin
   search_request.album = Song::AlbumRemoveDiscMisc(album);
   search_request.title = Song::TitleRemoveMisc(title);
 
+  // Serve the persistent store first. Positive entries are kept forever, negative ones are retried after 30 days.
+  const QFileInfo store_fileinfo(StoreFilePath(search_request));
+  if (store_fileinfo.exists()) {
+    constexpr qint64 kNegativeEntryTTLSecs = 30LL * 24 * 3600;
+    const bool negative = store_fileinfo.size() == 0;
+    if (!negative || store_fileinfo.lastModified().secsTo(QDateTime::currentDateTime()) < kNegativeEntryTTLSecs) {
+      QString lyrics;
+      if (!negative) {
+        QFile store_file(store_fileinfo.filePath());
+        if (store_file.open(QIODevice::ReadOnly)) {
+          lyrics = QString::fromUtf8(store_file.readAll());
+        }
+      }
+      const quint64 id = ++next_id_;
+      QMetaObject::invokeMethod(this, [this, id, search_request, lyrics]() {
+        LyricsSearchResults results;
+        if (!lyrics.isEmpty()) {
+          LyricsSearchResult result(lyrics);
+          result.provider = QStringLiteral("cache");
+          result.artist = search_request.artist;
+          result.album = search_request.album;
+          result.title = search_request.title;
+          results << result;
+        }
+        Q_EMIT LyricsFetched(id, lyrics.isEmpty() ? QString() : QStringLiteral("cache"), lyrics);
+        Q_EMIT SearchFinished(id, results);
+      }, Qt::QueuedConnection);
+      return id;
+    }
+  }
+
   Request request;
   request.id = ++next_id_;
   request.search_request = search_request;
@@ -66,6 +103,24 @@ quint64 LyricsFetcher::Search(const QString &effective_albumartist, const QStrin
 
 }
 
+QString LyricsFetcher::StoreFilePath(const LyricsSearchRequest &search_request) {
+
+  const QString key = search_request.artist.toLower() + QLatin1Char('|') + search_request.title.toLower();
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/lyrics/") + QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()) + QStringLiteral(".txt");
+
+}
+
+void LyricsFetcher::SaveToStore(const LyricsSearchRequest &search_request, const QString &lyrics) const {
+
+  const QString store_file_path = StoreFilePath(search_request);
+  if (!QDir().mkpath(QFileInfo(store_file_path).absolutePath())) return;
+  QFile store_file(store_file_path);
+  if (store_file.open(QIODevice::WriteOnly)) {
+    store_file.write(lyrics.toUtf8());
+  }
+
+}
+
 void LyricsFetcher::AddRequest(const Request &request) {
 
   queued_requests_.enqueue(request);
@@ -86,6 +141,7 @@ void LyricsFetcher::Clear() {
     search->deleteLater();
   }
   active_requests_.clear();
+  active_search_requests_.clear();
 
 }
 
@@ -102,6 +158,7 @@ void LyricsFetcher::StartRequests() {
 
     LyricsFetcherSearch *search = new LyricsFetcherSearch(request.id, request.search_request, this);
     active_requests_.insert(request.id, search);
+    active_search_requests_.insert(request.id, request.search_request);
 
     QObject::connect(search, &LyricsFetcherSearch::SearchFinished, this, &LyricsFetcher::SingleSearchFinished);
     QObject::connect(search, &LyricsFetcherSearch::LyricsFetched, this, &LyricsFetcher::SingleLyricsFetched);
@@ -117,6 +174,7 @@ void LyricsFetcher::SingleSearchFinished(const quint64 request_id, const LyricsS
 
   LyricsFetcherSearch *search = active_requests_.take(request_id);
   search->deleteLater();
+  active_search_requests_.remove(request_id);
   Q_EMIT SearchFinished(request_id, results);
 
 }
@@ -127,6 +185,16 @@ void LyricsFetcher::SingleLyricsFetched(const quint64 request_id, const QString
 
   LyricsFetcherSearch *search = active_requests_.take(request_id);
   search->deleteLater();
+
+  // Record the outcome, including "nothing found", so the next play of this song doesn't search again.
+  // Unless every provider failed (offline, expired authentication): caching that as a negative would lock the song out of lyrics for the whole TTL.
+  if (active_search_requests_.contains(request_id)) {
+    const LyricsSearchRequest search_request = active_search_requests_.take(request_id);
+    if (!lyrics.isEmpty() || search->any_provider_success()) {
+      SaveToStore(search_request, lyrics);
+    }
+  }
+
   Q_EMIT LyricsFetched(request_id, provider, lyrics);
 
 }
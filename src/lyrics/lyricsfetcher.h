@@ -58,6 +58,10 @@ class LyricsFetcher : public QObject {
 
  private:
   void AddRequest(const Request &request);
+  // One file per artist/title in the cache directory; an empty file records that no lyrics were found,
+  // retried again after the negative entry expires.
+  static QString StoreFilePath(const LyricsSearchRequest &search_request);
+  void SaveToStore(const LyricsSearchRequest &search_request, const QString &lyrics) const;
 
  Q_SIGNALS:
   void LyricsFetched(const quint64 request_id, const QString &provider, const QString &lyrics);
@@ -74,6 +78,7 @@ class LyricsFetcher : public QObject {
 
   QQueue<Request> queued_requests_;
   QHash<quint64, LyricsFetcherSearch*> active_requests_;
+  QHash<quint64, LyricsSearchRequest> active_search_requests_;
 
   QTimer *request_starter_;
 };
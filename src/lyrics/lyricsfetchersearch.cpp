@@ -45,7 +45,9 @@ LyricsFetcherSearch::LyricsFetcherSearch(const quint64 id, const LyricsSearchReq
     : QObject(parent),
       id_(id),
       request_(request),
-      cancel_requested_(false) {
+      finished_(false),
+      cancel_requested_(false),
+      any_provider_success_(false) {
 
   QTimer::singleShot(kSearchTimeoutMs, this, &LyricsFetcherSearch::TerminateSearch);
 
@@ -69,14 +71,49 @@ void LyricsFetcherSearch::Start(SharedPtr<LyricsProviders> lyrics_providers) {
     return;
   }
 
+  lyrics_providers_ = lyrics_providers;
+
   QList<LyricsProvider*> lyrics_providers_sorted = lyrics_providers->List();
   std::stable_sort(lyrics_providers_sorted.begin(), lyrics_providers_sorted.end(), ProviderCompareOrder);
 
+  // Race the two preferred providers first; the rest only join after a grace period (or when the first tier comes up empty),
+  // so a good answer from a preferred provider costs two requests instead of one per provider.
+  constexpr int kInitialProviders = 2;
+  int started = 0;
   for (LyricsProvider *provider : std::as_const(lyrics_providers_sorted)) {
     if (!provider->is_enabled() || !provider->IsAuthenticated()) continue;
+    if (started >= kInitialProviders) {
+      deferred_providers_ << provider;
+      continue;
+    }
     QObject::connect(provider, &LyricsProvider::SearchFinished, this, &LyricsFetcherSearch::ProviderSearchFinished);
     const int id = lyrics_providers->NextId();
     const bool success = provider->StartSearchAsync(id, request_);
+    if (success) {
+      pending_requests_.insert(id, provider);
+      ++started;
+    }
+  }
+
+  if (!deferred_providers_.isEmpty()) {
+    QTimer::singleShot(500, this, &LyricsFetcherSearch::StartDeferredProviders);
+  }
+
+  if (pending_requests_.isEmpty() && deferred_providers_.isEmpty()) TerminateSearch();
+  else if (pending_requests_.isEmpty()) StartDeferredProviders();
+
+}
+
+void LyricsFetcherSearch::StartDeferredProviders() {
+
+  if (finished_ || cancel_requested_ || deferred_providers_.isEmpty()) return;
+
+  const QList<LyricsProvider*> providers = deferred_providers_;
+  deferred_providers_.clear();
+  for (LyricsProvider *provider : providers) {
+    QObject::connect(provider, &LyricsProvider::SearchFinished, this, &LyricsFetcherSearch::ProviderSearchFinished);
+    const int id = lyrics_providers_->NextId();
+    const bool success = provider->StartSearchAsync(id, request_);
     if (success) {
       pending_requests_.insert(id, provider);
     }
@@ -86,11 +123,13 @@ void LyricsFetcherSearch::Start(SharedPtr<LyricsProviders> lyrics_providers) {
 
 }
 
-void LyricsFetcherSearch::ProviderSearchFinished(const int id, const LyricsSearchResults &results) {
+void LyricsFetcherSearch::ProviderSearchFinished(const int id, const LyricsSearchResults &results, const bool error) {
 
   if (!pending_requests_.contains(id)) return;
   LyricsProvider *provider = pending_requests_.take(id);
 
+  if (!error) any_provider_success_ = true;
+
   LyricsSearchResults results_copy(results);
   float higest_score = 0.0;
   for (int i = 0; i < results_copy.count(); ++i) {
@@ -115,24 +154,36 @@ void LyricsFetcherSearch::ProviderSearchFinished(const int id, const LyricsSearc
   results_.append(results_copy);
   std::stable_sort(results_.begin(), results_.end(), LyricsSearchResultCompareScore);
 
-  if (!pending_requests_.isEmpty()) {
-    if (!results_.isEmpty() && higest_score >= kHighScore) {  // Highest score, no need to wait for other providers.
-      qLog(Debug) << "Got lyrics with high score from" << results_.last().provider << "for" << request_.artist << request_.title << "score" << results_.last().score << "finishing search.";
+  if (!results_.isEmpty() && higest_score >= kHighScore) {  // Highest score, no need to wait for other providers.
+    qLog(Debug) << "Got lyrics with high score from" << results_.last().provider << "for" << request_.artist << request_.title << "score" << results_.last().score << "finishing search.";
+    deferred_providers_.clear();
+    if (!pending_requests_.isEmpty()) {
       TerminateSearch();
     }
     else {
-      return;
+      AllProvidersFinished();
     }
     return;
   }
 
+  if (!pending_requests_.isEmpty()) {
+    return;
+  }
+
+  // The first tier came up empty or weak, bring in the remaining providers right away.
+  if (!deferred_providers_.isEmpty()) {
+    StartDeferredProviders();
+    return;
+  }
+
   AllProvidersFinished();
 
 }
 
 void LyricsFetcherSearch::AllProvidersFinished() {
 
-  if (cancel_requested_) return;
+  if (finished_ || cancel_requested_) return;
+  finished_ = true;
 
   if (!results_.isEmpty()) {
     qLog(Debug) << "Using lyrics from" << results_.last().provider << "for" << request_.artist << request_.title << "with score" << results_.last().score;
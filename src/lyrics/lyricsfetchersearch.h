@@ -43,13 +43,18 @@ class LyricsFetcherSearch : public QObject {
   void Start(SharedPtr<LyricsProviders> lyrics_providers);
   void Cancel();
 
+  // Whether any provider completed its search without a provider or network error.
+  // A "no lyrics" outcome is only worth caching when this is true.
+  bool any_provider_success() const { return any_provider_success_; }
+
  Q_SIGNALS:
   void SearchFinished(const quint64 id, const LyricsSearchResults &results);
   void LyricsFetched(const quint64 id, const QString &provider, const QString &lyrics);
 
  private Q_SLOTS:
-  void ProviderSearchFinished(const int id, const LyricsSearchResults &results);
+  void ProviderSearchFinished(const int id, const LyricsSearchResults &results, const bool error);
   void TerminateSearch();
+  void StartDeferredProviders();
 
  private:
   void AllProvidersFinished();
@@ -61,7 +66,12 @@ class LyricsFetcherSearch : public QObject {
   const LyricsSearchRequest request_;
   LyricsSearchResults results_;
   QMap<int, LyricsProvider*> pending_requests_;
+  // Providers beyond the first tier, raced in only if the preferred providers don't answer well quickly.
+  QList<LyricsProvider*> deferred_providers_;
+  SharedPtr<LyricsProviders> lyrics_providers_;
+  bool finished_;
   bool cancel_requested_;
+  bool any_provider_success_;
 };
 
 #endif  // LYRICSFETCHERSEARCH_H
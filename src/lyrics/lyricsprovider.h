@@ -63,7 +63,8 @@ class LyricsProvider : public QObject {
   void AuthenticationComplete(const bool success, const QStringList &errors = QStringList());
   void AuthenticationSuccess();
   void AuthenticationFailure(const QStringList &errors);
-  void SearchFinished(const int id, const LyricsSearchResults &results = LyricsSearchResults());
+  // error distinguishes provider/network failures from a successful search that found no lyrics.
+  void SearchFinished(const int id, const LyricsSearchResults &results = LyricsSearchResults(), const bool error = false);
 
  protected:
   const SharedPtr<NetworkAccessManager> network_;
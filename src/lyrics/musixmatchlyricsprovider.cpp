@@ -118,6 +118,7 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
       return;
     }
     Error(QStringLiteral("%1 (%2)").arg(reply->errorString()).arg(reply->error()));
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -130,6 +131,7 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
       return;
     }
     Error(QStringLiteral("Received HTTP code %1").arg(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt()));
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -137,17 +139,20 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
   QByteArray data = reply->readAll();
   QJsonObject json_obj = ExtractJsonObj(data);
   if (json_obj.isEmpty()) {
+    search->error = true;
     EndSearch(search);
     return;
   }
 
   if (!json_obj.contains("message"_L1)) {
     Error(u"Json reply is missing message object."_s, json_obj);
+    search->error = true;
     EndSearch(search);
     return;
   }
   if (!json_obj["message"_L1].isObject()) {
     Error(u"Json reply message is not an object."_s, json_obj);
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -155,11 +160,13 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_message.contains("header"_L1)) {
     Error(u"Json reply message object is missing header."_s, obj_message);
+    search->error = true;
     EndSearch(search);
     return;
   }
   if (!obj_message["header"_L1].isObject()) {
     Error(u"Json reply message header is not an object."_s, obj_message);
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -175,11 +182,13 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_message.contains("body"_L1)) {
     Error(u"Json reply is missing body."_s, json_obj);
+    search->error = true;
     EndSearch(search);
     return;
   }
   if (!obj_message["body"_L1].isObject()) {
     Error(u"Json body is not an object."_s, json_obj);
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -187,11 +196,13 @@ void MusixmatchLyricsProvider::HandleSearchReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_body.contains("track_list"_L1)) {
     Error(u"Json response is missing body."_s, obj_body);
+    search->error = true;
     EndSearch(search);
     return;
   }
   if (!obj_body["track_list"_L1].isArray()) {
     Error(u"Json hits is not an array."_s, obj_body);
+    search->error = true;
     EndSearch(search);
     return;
   }
@@ -288,11 +299,13 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (reply->error() != QNetworkReply::NoError) {
     Error(QStringLiteral("%1 (%2)").arg(reply->errorString()).arg(reply->error()));
+    search->error = true;
     EndSearch(search, url);
     return;
   }
   if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() != 200) {
     Error(QStringLiteral("Received HTTP code %1").arg(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt()));
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -300,6 +313,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
   const QByteArray data = reply->readAll();
   if (data.isEmpty()) {
     Error(u"Empty reply received from server."_s);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -336,6 +350,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("props"_L1) || !obj_data["props"_L1].isObject()) {
     Error(u"Json reply is missing props."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -343,6 +358,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("pageProps"_L1) || !obj_data["pageProps"_L1].isObject()) {
     Error(u"Json props is missing pageProps."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -350,6 +366,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("data"_L1) || !obj_data["data"_L1].isObject()) {
     Error(u"Json pageProps is missing data."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -358,6 +375,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("trackInfo"_L1) || !obj_data["trackInfo"_L1].isObject()) {
     Error(u"Json data is missing trackInfo."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -365,6 +383,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("data"_L1) || !obj_data["data"_L1].isObject()) {
     Error(u"Json trackInfo reply is missing data."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -372,6 +391,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("track"_L1) || !obj_data["track"_L1].isObject()) {
     Error(u"Json data is missing track."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -380,6 +400,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_track.contains("hasLyrics"_L1) || !obj_track["hasLyrics"_L1].isBool()) {
     Error(u"Json track is missing hasLyrics."_s, obj_track);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -403,6 +424,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_data.contains("lyrics"_L1) || !obj_data["lyrics"_L1].isObject()) {
     Error(u"Json data is missing lyrics."_s, obj_data);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -410,6 +432,7 @@ void MusixmatchLyricsProvider::HandleLyricsReply(QNetworkReply *reply, LyricsSea
 
   if (!obj_lyrics.contains("body"_L1) || !obj_lyrics["body"_L1].isString()) {
     Error(u"Json lyrics reply is missing body."_s, obj_lyrics);
+    search->error = true;
     EndSearch(search, url);
     return;
   }
@@ -438,7 +461,7 @@ void MusixmatchLyricsProvider::EndSearch(LyricsSearchContextPtr search, const QU
     else {
       qLog(Debug) << "MusixmatchLyrics: Got lyrics for" << search->request.artist << search->request.title;
     }
-    Q_EMIT SearchFinished(search->id, search->results);
+    Q_EMIT SearchFinished(search->id, search->results, search->error);
   }
 
 }
@@ -47,11 +47,12 @@ class MusixmatchLyricsProvider : public JsonLyricsProvider, public MusixmatchPro
 
  private:
   struct LyricsSearchContext {
-    explicit LyricsSearchContext() : id(-1) {}
+    explicit LyricsSearchContext() : id(-1), error(false) {}
     int id;
     LyricsSearchRequest request;
     QList<QUrl> requests_lyrics_;
     LyricsSearchResults results;
+    bool error;
   };
 
   using LyricsSearchContextPtr = SharedPtr<LyricsSearchContext>;
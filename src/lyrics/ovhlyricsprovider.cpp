@@ -78,7 +78,7 @@ void OVHLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int id, co
 
   QJsonObject json_obj = ExtractJsonObj(reply);
   if (json_obj.isEmpty()) {
-    Q_EMIT SearchFinished(id);
+    Q_EMIT SearchFinished(id, LyricsSearchResults(), true);
     return;
   }
 
@@ -90,7 +90,7 @@ void OVHLyricsProvider::HandleSearchReply(QNetworkReply *reply, const int id, co
   }
 
   if (!json_obj.contains("lyrics"_L1)) {
-    Q_EMIT SearchFinished(id);
+    Q_EMIT SearchFinished(id, LyricsSearchResults(), true);
     return;
   }
 
@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <memory>
+#include <utility>
 
 #ifdef Q_OS_UNIX
 #  include <unistd.h>
@@ -45,6 +46,9 @@
 #include <glib.h>
 
 #include <QObject>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QThreadPool>
 #include <QApplication>
 #include <QCoreApplication>
 #include <QSysInfo>
@@ -300,8 +304,18 @@ int main(int argc, char *argv[]) {
 
 #endif
 
+  // The old ConcurrentRun helper was already replaced by QtConcurrent on the shared global pool.
+  // Several of those tasks block on the database mutex rather than using CPU, so allow a couple of
+  // extra pool threads to keep CPU-bound work from queueing behind blocked ones.
+  QThreadPool::globalInstance()->setMaxThreadCount(QThread::idealThreadCount() + 2);
+
+  QElapsedTimer startup_timer;
+  startup_timer.start();
+
   Application app;
 
+  const qint64 app_construct_msec = startup_timer.elapsed();
+
   // Network proxy
   QNetworkProxyFactory::setApplicationProxyFactory(NetworkProxyFactory::Instance());
 
@@ -323,6 +337,29 @@ int main(int argc, char *argv[]) {
   // Window
   MainWindow w(&app, tray_icon, &osd, options);
 
+  {
+    // Startup phase profile, with the history of previous runs persisted so regressions are visible in the log.
+    const qint64 window_construct_msec = startup_timer.elapsed() - app_construct_msec;
+    const qint64 total_msec = startup_timer.elapsed();
+    qLog(Debug) << "Startup profile: application" << app_construct_msec << "ms, main window" << window_construct_msec << "ms, total" << total_msec << "ms";
+
+    Settings settings;
+    settings.beginGroup("StartupProfile");
+    QList<QVariant> history = settings.value("history").toList();
+    if (history.count() >= 2) {
+      qint64 sum_msec = 0;
+      for (const QVariant &value : std::as_const(history)) sum_msec += value.toLongLong();
+      const qint64 average_msec = sum_msec / history.count();
+      if (average_msec > 0 && total_msec > average_msec * 3 / 2) {
+        qLog(Warning) << "Startup took" << total_msec << "ms, more than 50% above the average of the last" << history.count() << "runs (" << average_msec << "ms )";
+      }
+    }
+    history << total_msec;
+    while (history.count() > 10) history.removeFirst();
+    settings.setValue("history", history);
+    settings.endGroup();
+  }
+
 #ifdef Q_OS_MACOS
   mac::EnableFullScreen(w);
 #endif  // Q_OS_MACOS
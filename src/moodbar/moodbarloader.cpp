@@ -59,6 +59,7 @@ using namespace Qt::Literals::StringLiterals;
 MoodbarLoader::MoodbarLoader(QObject *parent)
     : QObject(parent),
       cache_(new QNetworkDiskCache(this)),
+      data_cache_(4 * 1024 * 1024),
       thread_(new QThread(this)),
       kMaxActiveRequests(qMax(1, QThread::idealThreadCount() / 2)),
       save_(false) {
@@ -104,7 +105,7 @@ QUrl MoodbarLoader::CacheUrlEntry(const QString &filename) {
 
 }
 
-MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, QByteArray *data, MoodbarPipeline **async_pipeline) {
+MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, QByteArray *data, MoodbarPipeline **async_pipeline, const Priority priority) {
 
   if (!url.isLocalFile() || has_cue) {
     return Result::CannotLoad;
@@ -112,10 +113,21 @@ MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, Q
 
   // Are we in the middle of loading this moodbar already?
   if (requests_.contains(url)) {
+    // Bump an already queued request to the front when it's now needed urgently.
+    if (priority == Priority::High && queued_requests_.contains(url)) {
+      queued_requests_.removeAll(url);
+      queued_requests_.prepend(url);
+    }
     *async_pipeline = requests_.value(url);
     return Result::WillLoadAsync;
   }
 
+  // Already loaded this session?
+  if (const QByteArray *cached_data = data_cache_.object(url)) {
+    *data = *cached_data;
+    return Result::Loaded;
+  }
+
   // Check if a mood file exists for this file already
   const QString filename(url.toLocalFile());
 
@@ -125,8 +137,16 @@ MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, Q
     if (f.exists()) {
       if (f.open(QIODevice::ReadOnly)) {
         qLog(Info) << "Loading moodbar data from" << possible_mood_file;
-        *data = f.readAll();
+        // Map the file instead of buffered reads, mood files are small and read in one go.
+        const uchar *mood_file_data = f.map(0, f.size());
+        if (mood_file_data) {
+          *data = QByteArray(reinterpret_cast<const char*>(mood_file_data), static_cast<qsizetype>(f.size()));
+        }
+        else {
+          *data = f.readAll();
+        }
         f.close();
+        data_cache_.insert(url, new QByteArray(*data), data->size());
         return Result::Loaded;
       }
       else {
@@ -144,6 +164,7 @@ MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, Q
       qLog(Info) << "Loading cached moodbar data for" << filename;
       *data = device_cache_file->readAll();
       if (!data->isEmpty()) {
+        data_cache_.insert(url, new QByteArray(*data), data->size());
         return Result::Loaded;
       }
     }
@@ -157,7 +178,12 @@ MoodbarLoader::Result MoodbarLoader::Load(const QUrl &url, const bool has_cue, Q
   QObject::connect(pipeline, &MoodbarPipeline::Finished, this, [this, pipeline, url]() { RequestFinished(pipeline, url); });
 
   requests_[url] = pipeline;
-  queued_requests_ << url;
+  if (priority == Priority::High) {
+    queued_requests_.prepend(url);
+  }
+  else {
+    queued_requests_ << url;
+  }
 
   MaybeTakeNextRequest();
 
@@ -192,6 +218,8 @@ void MoodbarLoader::RequestFinished(MoodbarPipeline *request, const QUrl &url) {
 
     qLog(Info) << "Moodbar data generated successfully for" << filename;
 
+    data_cache_.insert(url, new QByteArray(request->data()), request->data().size());
+
     // Save the data in the cache
     QNetworkCacheMetaData disk_cache_metadata;
     disk_cache_metadata.setSaveToDisk(true);
@@ -29,6 +29,7 @@
 #include <QString>
 #include <QStringList>
 #include <QUrl>
+#include <QCache>
 
 class QThread;
 class QByteArray;
@@ -57,7 +58,13 @@ class MoodbarLoader : public QObject {
 
   void ReloadSettings();
 
-  Result Load(const QUrl &url, const bool has_cue, QByteArray *data, MoodbarPipeline **async_pipeline);
+  // Requests from the currently playing track use Priority::High and jump ahead of queued background requests.
+  enum class Priority {
+    Normal,
+    High
+  };
+
+  Result Load(const QUrl &url, const bool has_cue, QByteArray *data, MoodbarPipeline **async_pipeline, const Priority priority = Priority::Normal);
 
  private Q_SLOTS:
   void RequestFinished(MoodbarPipeline *request, const QUrl &url);
@@ -74,6 +81,8 @@ class MoodbarLoader : public QObject {
 
  private:
   QNetworkDiskCache *cache_;
+  // Compact in-memory cache of already loaded moodbar data shared by all consumers, costed in bytes.
+  QCache<QUrl, QByteArray> data_cache_;
   QThread *thread_;
 
   const int kMaxActiveRequests;
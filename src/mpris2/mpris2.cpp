@@ -169,15 +169,19 @@ void Mpris2::PlaylistManagerInitialized() {
 
 void Mpris2::EngineStateChanged(EngineBase::State newState) {
 
+  QVariantMap properties;
+
   if (newState != EngineBase::State::Playing && newState != EngineBase::State::Paused) {
     last_metadata_ = QVariantMap();
-    EmitNotification(u"Metadata"_s);
+    properties.insert(u"Metadata"_s, Metadata());
   }
 
-  EmitNotification(u"CanPlay"_s);
-  EmitNotification(u"CanPause"_s);
-  EmitNotification(u"PlaybackStatus"_s, PlaybackStatus(newState));
-  if (newState == EngineBase::State::Playing) EmitNotification(u"CanSeek"_s, CanSeek(newState));
+  properties.insert(u"CanPlay"_s, CanPlay());
+  properties.insert(u"CanPause"_s, CanPause());
+  properties.insert(u"PlaybackStatus"_s, PlaybackStatus(newState));
+  if (newState == EngineBase::State::Playing) properties.insert(u"CanSeek"_s, CanSeek(newState));
+
+  EmitNotifications(properties);
 
 }
 
@@ -189,9 +193,11 @@ void Mpris2::ShuffleModeChanged() { EmitNotification(u"Shuffle"_s); }
 
 void Mpris2::RepeatModeChanged() {
 
-  EmitNotification(u"LoopStatus"_s);
-  EmitNotification(u"CanGoNext"_s, CanGoNext());
-  EmitNotification(u"CanGoPrevious"_s, CanGoPrevious());
+  QVariantMap properties;
+  properties.insert(u"LoopStatus"_s, LoopStatus());
+  properties.insert(u"CanGoNext"_s, CanGoNext());
+  properties.insert(u"CanGoPrevious"_s, CanGoPrevious());
+  EmitNotifications(properties);
 
 }
 
@@ -201,10 +207,19 @@ void Mpris2::EmitNotification(const QString &name, const QVariant &value) {
 
 void Mpris2::EmitNotification(const QString &name, const QVariant &value, const QString &mprisEntity) {
 
-  QDBusMessage msg = QDBusMessage::createSignal(QLatin1String(kMprisObjectPath), QLatin1String(kFreedesktopPath), u"PropertiesChanged"_s);
   QVariantMap map;
   map.insert(name, value);
-  QVariantList args = QVariantList() << mprisEntity << map << QStringList();
+  EmitNotifications(map, mprisEntity);
+
+}
+
+void Mpris2::EmitNotifications(const QVariantMap &properties, const QString &mprisEntity) {
+
+  if (properties.isEmpty()) return;
+
+  // One PropertiesChanged signal covering all of them, instead of one wakeup per property for every listener.
+  QDBusMessage msg = QDBusMessage::createSignal(QLatin1String(kMprisObjectPath), QLatin1String(kFreedesktopPath), u"PropertiesChanged"_s);
+  QVariantList args = QVariantList() << mprisEntity << properties << QStringList();
   msg.setArguments(args);
   QDBusConnection::sessionBus().send(msg);
 
@@ -394,11 +409,14 @@ QDBusObjectPath Mpris2::current_track_id() const {
 void Mpris2::CurrentSongChanged(const Song &song) {
 
   AlbumCoverLoaded(song);
-  EmitNotification(u"CanPlay"_s);
-  EmitNotification(u"CanPause"_s);
-  EmitNotification(u"CanGoNext"_s, CanGoNext());
-  EmitNotification(u"CanGoPrevious"_s, CanGoPrevious());
-  EmitNotification(u"CanSeek"_s, CanSeek());
+
+  QVariantMap properties;
+  properties.insert(u"CanPlay"_s, CanPlay());
+  properties.insert(u"CanPause"_s, CanPause());
+  properties.insert(u"CanGoNext"_s, CanGoNext());
+  properties.insert(u"CanGoPrevious"_s, CanGoPrevious());
+  properties.insert(u"CanSeek"_s, CanSeek());
+  EmitNotifications(properties);
 
 }
 
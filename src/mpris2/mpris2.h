@@ -227,6 +227,7 @@ class Mpris2 : public QObject {
   void EmitNotification(const QString &name);
   void EmitNotification(const QString &name, const QVariant &value);
   void EmitNotification(const QString &name, const QVariant &value, const QString &mprisEntity);
+  void EmitNotifications(const QVariantMap &properties, const QString &mprisEntity = QStringLiteral("org.mpris.MediaPlayer2.Player"));
 
   QString PlaybackStatus(EngineBase::State state) const;
 
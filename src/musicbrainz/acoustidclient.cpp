@@ -83,12 +83,13 @@ void AcoustidClient::Start(const int id, const QString &fingerprint, int duratio
 
   QUrlQuery url_query;
   url_query.setQueryItems(params);
-  QUrl url(QString::fromLatin1(kUrl));
-  url.setQuery(url_query);
 
-  QNetworkRequest req(url);
+  // Fingerprints are kilobytes; submit them as a POST body instead of stuffing them into the URL,
+  // which keeps bulk lookups inside URL length limits and lets the whole batch reuse one multiplexed connection.
+  QNetworkRequest req((QUrl(QString::fromLatin1(kUrl))));
   req.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::NoLessSafeRedirectPolicy);
-  QNetworkReply *reply = network_->get(req);
+  req.setHeader(QNetworkRequest::ContentTypeHeader, u"application/x-www-form-urlencoded"_s);
+  QNetworkReply *reply = network_->post(req, url_query.toString(QUrl::FullyEncoded).toUtf8());
   QObject::connect(reply, &QNetworkReply::finished, this, [this, reply, id]() { RequestFinished(reply, id); });
   requests_[id] = reply;
 
@@ -176,6 +176,13 @@ void MusicBrainzClient::FlushRequests() {
 
   if (!requests_.isEmpty() || requests_pending_.isEmpty()) return;
 
+  // Serve cached recordings immediately, they don't consume a rate-limited request slot.
+  while (!requests_pending_.isEmpty() && mbid_cache_.contains(requests_pending_.first().mbid)) {
+    const Request cached_request = requests_pending_.take(requests_pending_.firstKey());
+    DeliverResults(cached_request.id, cached_request.number, mbid_cache_.value(cached_request.mbid));
+  }
+  if (requests_pending_.isEmpty()) return;
+
   Request request = requests_pending_.take(requests_pending_.firstKey());
 
   const ParamList params = ParamList() << Param(u"inc"_s, u"artists+releases+media"_s);
@@ -188,14 +195,14 @@ void MusicBrainzClient::FlushRequests() {
   QNetworkRequest req(url);
   req.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::NoLessSafeRedirectPolicy);
   QNetworkReply *reply = network_->get(req);
-  QObject::connect(reply, &QNetworkReply::finished, this, [this, reply, request]() { RequestFinished(reply, request.id, request.number); });
+  QObject::connect(reply, &QNetworkReply::finished, this, [this, reply, request]() { RequestFinished(reply, request.id, request.number, request.mbid); });
   requests_.insert(request.id, reply);
 
   timeouts_->AddReply(reply);
 
 }
 
-void MusicBrainzClient::RequestFinished(QNetworkReply *reply, const int id, const int request_number) {
+void MusicBrainzClient::RequestFinished(QNetworkReply *reply, const int id, const int request_number, const QString &request_mbid) {
 
   QObject::disconnect(reply, nullptr, this, nullptr);
   reply->deleteLater();
@@ -224,6 +231,7 @@ void MusicBrainzClient::RequestFinished(QNetworkReply *reply, const int id, cons
         }
       }
     }
+    mbid_cache_.insert(request_mbid, res);
     pending_results_[id] << PendingResults(request_number, res);
   }
 
@@ -241,6 +249,22 @@ void MusicBrainzClient::RequestFinished(QNetworkReply *reply, const int id, cons
 
 }
 
+void MusicBrainzClient::DeliverResults(const int id, const int request_number, const ResultList &results) {
+
+  pending_results_[id] << PendingResults(request_number, results);
+
+  if (!requests_.contains(id) && !requests_pending_.contains(id)) {
+    ResultList ret;
+    QList<PendingResults> result_list_list = pending_results_.take(id);
+    std::sort(result_list_list.begin(), result_list_list.end());
+    for (const PendingResults &result_list : std::as_const(result_list_list)) {
+      ret << result_list.results_;
+    }
+    Q_EMIT Finished(id, UniqueResults(ret, UniqueResultsSortOption::KeepOriginalOrder), QString());
+  }
+
+}
+
 void MusicBrainzClient::DiscIdRequestFinished(const QString &discid, QNetworkReply *reply) {
 
   QObject::disconnect(reply, nullptr, this, nullptr);
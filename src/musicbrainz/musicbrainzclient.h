@@ -109,8 +109,9 @@ class MusicBrainzClient : public QObject {
 
  private Q_SLOTS:
   void FlushRequests();
+  void DeliverResults(const int id, const int request_number, const ResultList &results);
   // id identifies the track, and request_number means it's the 'request_number'th request for this track
-  void RequestFinished(QNetworkReply *reply, const int id, const int request_number);
+  void RequestFinished(QNetworkReply *reply, const int id, const int request_number, const QString &request_mbid);
   void DiscIdRequestFinished(const QString &discid, QNetworkReply *reply);
 
  private:
@@ -208,6 +209,8 @@ class MusicBrainzClient : public QObject {
   QMultiMap<int, QNetworkReply*> requests_;
   // Results we received so far, kept here until all the replies are finished
   QMap<int, QList<PendingResults>> pending_results_;
+  // Parsed results per recording id; repeated lookups of the same recording skip the network and the rate limiter.
+  QMap<QString, ResultList> mbid_cache_;
   QTimer *timer_flush_requests_;
 
 };
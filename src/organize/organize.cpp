@@ -27,6 +27,8 @@
 
 #include <QThread>
 #include <QFile>
+#include <QCryptographicHash>
+#include <QStandardPaths>
 #include <QFileInfo>
 #include <QTimer>
 #include <QDateTime>
@@ -126,12 +128,51 @@ void Organize::Start() {
 
 }
 
+QString Organize::TranscodeCachePath(const QString &source, const TranscoderPreset &preset) {
+
+  const QFileInfo fileinfo(source);
+  const QString key = source + QLatin1Char('|') + QString::number(fileinfo.lastModified().toSecsSinceEpoch()) + QLatin1Char('|') + QString::number(fileinfo.size()) + QLatin1Char('|') + QString::number(static_cast<int>(preset.filetype_));
+  const QString cache_dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/transcoded");
+  QDir().mkpath(cache_dir);
+  return cache_dir + QLatin1Char('/') + QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex()) + QLatin1Char('.') + preset.extension_;
+
+}
+
+void Organize::TrimTranscodeCache() {
+
+  constexpr qint64 kMaxCacheBytes = 2LL * 1024 * 1024 * 1024;
+
+  const QString cache_dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/transcoded");
+  QFileInfoList files = QDir(cache_dir).entryInfoList(QDir::Files, QDir::Time | QDir::Reversed);  // oldest first
+  qint64 total = 0;
+  for (const QFileInfo &fileinfo : files) total += fileinfo.size();
+  for (const QFileInfo &fileinfo : files) {
+    if (total <= kMaxCacheBytes) break;
+    total -= fileinfo.size();
+    QFile::remove(fileinfo.filePath());
+  }
+
+}
+
 void Organize::ProcessSomeFiles() {
 
   if (finished_) return;
 
   if (!started_) {
-    if (!destination_->StartCopy(&supported_filetypes_)) {
+    // Preflight: make sure the destination can hold the whole batch before moving anything.
+    qint64 bytes_required = 0;
+    for (const Task &task : std::as_const(tasks_pending_)) {
+      bytes_required += task.song_info_.song_.filesize();
+    }
+    QString space_error_text;
+    if (!destination_->CheckFreeSpace(bytes_required, space_error_text)) {
+      for (const Task &task : std::as_const(tasks_pending_)) {
+        files_with_errors_ << task.song_info_.song_.url().toLocalFile();
+      }
+      tasks_pending_.clear();
+      if (!space_error_text.isEmpty()) log_ << space_error_text;
+    }
+    else if (!destination_->StartCopy(&supported_filetypes_)) {
       // Failed to start - mark everything as failed :(
       for (const Task &task : std::as_const(tasks_pending_)) {
         files_with_errors_ << task.song_info_.song_.url().toLocalFile();
@@ -139,6 +180,7 @@ void Organize::ProcessSomeFiles() {
       tasks_pending_.clear();
     }
     started_ = true;
+    TrimTranscodeCache();
   }
 
   // None left?
@@ -173,6 +215,9 @@ void Organize::ProcessSomeFiles() {
   }
 
   // We process files in batches so we can be cancelled part-way through.
+  // Database path updates for the whole batch are collected and committed together afterwards.
+  SongList path_changed_songs;
+  QList<QFileInfo> path_changed_new_files;
   for (int i = 0; i < kBatchSize; ++i) {
     SetSongProgress(0);
 
@@ -208,7 +253,20 @@ void Organize::ProcessSomeFiles() {
         TranscoderPreset preset = Transcoder::PresetForFileType(dest_type);
         qLog(Debug) << "Transcoding with" << preset.name_;
 
-        task.transcoded_filename_ = transcoder_->GetFile(task.song_info_.song_.url().toLocalFile(), preset);
+        // Outputs are cached per source file and preset, so re-syncing the same songs skips the transcode entirely.
+        const QString cache_path = TranscodeCachePath(task.song_info_.song_.url().toLocalFile(), preset);
+        if (QFile::exists(cache_path)) {
+          qLog(Debug) << "Reusing cached transcode" << cache_path;
+          task.transcoded_filename_ = cache_path;
+          task.new_extension_ = preset.extension_;
+          task.new_filetype_ = dest_type;
+          tasks_pending_.prepend(task);
+          continue;
+        }
+
+        // Transcode to a temporary name first; the finished file is renamed into the cache on success,
+        // so a crash mid-transcode can't leave a truncated file that later syncs would reuse.
+        task.transcoded_filename_ = cache_path + QStringLiteral(".tmp");
         task.new_extension_ = preset.extension_;
         task.new_filetype_ = dest_type;
         tasks_transcoding_[task.song_info_.song_.url().toLocalFile()] = task;
@@ -265,8 +323,8 @@ void Organize::ProcessSomeFiles() {
       if (job.remove_original_ && song.is_collection_song() && destination_->source() == Song::Source::Collection) {
         // Notify other aspects of system that song has been invalidated
         QString root = destination_->LocalPath();
-        QFileInfo new_file = QFileInfo(root + QLatin1Char('/') + task.song_info_.new_filename_);
-        Q_EMIT SongPathChanged(song, new_file, destination_->collection_directory_id());
+        path_changed_songs << song;
+        path_changed_new_files << QFileInfo(root + QLatin1Char('/') + task.song_info_.new_filename_);
       }
     }
     else {
@@ -276,13 +334,15 @@ void Organize::ProcessSomeFiles() {
       }
     }
 
-    // Clean up the temporary transcoded file
-    if (!task.transcoded_filename_.isEmpty()) {
-      QFile::remove(task.transcoded_filename_);
-    }
+    // Cached transcode outputs are kept for the next sync; the cache is trimmed separately.
 
     tasks_complete_++;
   }
+
+  if (!path_changed_songs.isEmpty()) {
+    Q_EMIT SongsPathChanged(path_changed_songs, path_changed_new_files, destination_->collection_directory_id());
+  }
+
   SetSongProgress(0);
 
   if (!process_files_timer_->isActive()) {
@@ -369,8 +429,19 @@ void Organize::FileTranscoded(const QString &input, const QString &output, bool
   Task task = tasks_transcoding_.take(input);
   if (!success) {
     files_with_errors_ << input;
+    // Don't leave a partial output behind as a "cached" transcode.
+    if (!task.transcoded_filename_.isEmpty()) QFile::remove(task.transcoded_filename_);
   }
   else {
+    // Move the finished transcode into the cache atomically.
+    if (task.transcoded_filename_.endsWith(QLatin1String(".tmp"))) {
+      const QString cache_path = task.transcoded_filename_.chopped(4);
+      QFile::remove(cache_path);
+      if (QFile::rename(task.transcoded_filename_, cache_path)) {
+        task.transcoded_filename_ = cache_path;
+      }
+      // On rename failure the temporary file is still a complete transcode, use it directly; it won't be cached.
+    }
     tasks_pending_ << task;
   }
 
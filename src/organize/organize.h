@@ -80,7 +80,7 @@ class Organize : public QObject {
  Q_SIGNALS:
   void Finished(const QStringList &files_with_errors, const QStringList&);
   void FileCopied(const int database_id);
-  void SongPathChanged(const Song &song, const QFileInfo &new_file, const std::optional<int> new_collection_directory_id);
+  void SongsPathChanged(const SongList &songs, const QList<QFileInfo> &new_files, const std::optional<int> new_collection_directory_id);
 
  protected:
   void timerEvent(QTimerEvent *e) override;
@@ -94,6 +94,9 @@ class Organize : public QObject {
   void SetSongProgress(float progress, bool transcoded = false);
   void UpdateProgress();
   Song::FileType CheckTranscode(Song::FileType original_type) const;
+  // Cache of transcoded outputs keyed by source path, mtime, size and preset, kept across syncs and trimmed to a size cap.
+  static QString TranscodeCachePath(const QString &source, const TranscoderPreset &preset);
+  static void TrimTranscodeCache();
 
  private:
   struct Task {
@@ -204,7 +204,7 @@ void OrganizeDialog::accept() {
   QObject::connect(organize, &Organize::Finished, this, &OrganizeDialog::OrganizeFinished);
   QObject::connect(organize, &Organize::FileCopied, this, &OrganizeDialog::FileCopied);
   if (collection_backend_) {
-    QObject::connect(organize, &Organize::SongPathChanged, &*collection_backend_, &CollectionBackend::SongPathChanged);
+    QObject::connect(organize, &Organize::SongsPathChanged, &*collection_backend_, &CollectionBackend::SongsPathChanged);
   }
 
   organize->Start();
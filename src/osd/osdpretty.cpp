@@ -84,6 +84,7 @@ constexpr int kSnapProximity = 20;
 OSDPretty::OSDPretty(const Mode mode, QWidget *parent)
     : QWidget(parent),
       ui_(new Ui_OSDPretty),
+      scaled_icon_source_key_(0),
       mode_(mode),
       background_color_(OSDPrettySettings::kPresetBlue),
       background_opacity_(0.85),
@@ -343,9 +344,14 @@ void OSDPretty::paintEvent(QPaintEvent *e) {
 void OSDPretty::SetMessage(const QString &summary, const QString &message, const QImage &image) {
 
   if (!image.isNull()) {
-    QImage scaled_image = image.scaled(static_cast<int>(kMaxIconSize * devicePixelRatioF()), static_cast<int>(kMaxIconSize * devicePixelRatioF()), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-    scaled_image.setDevicePixelRatio(devicePixelRatioF());
-    ui_->icon->setPixmap(QPixmap::fromImage(scaled_image));
+    // Pause, resume and volume popups all reuse the cover of the playing track, scale it once per image.
+    if (image.cacheKey() != scaled_icon_source_key_ || scaled_icon_.isNull()) {
+      QImage scaled_image = image.scaled(static_cast<int>(kMaxIconSize * devicePixelRatioF()), static_cast<int>(kMaxIconSize * devicePixelRatioF()), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      scaled_image.setDevicePixelRatio(devicePixelRatioF());
+      scaled_icon_ = QPixmap::fromImage(scaled_image);
+      scaled_icon_source_key_ = image.cacheKey();
+    }
+    ui_->icon->setPixmap(scaled_icon_);
     ui_->icon->show();
   }
   else {
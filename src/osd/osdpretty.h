@@ -124,6 +124,9 @@ class OSDPretty : public QWidget {
 
  private:
   Ui_OSDPretty *ui_;
+  // Cover icon scaled for the popup, keyed by the source image so repeated popups for the same track reuse it.
+  QPixmap scaled_icon_;
+  qint64 scaled_icon_source_key_;
 
   Mode mode_;
 
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <utility>
+#include <limits>
 #include <memory>
 #include <functional>
 #include <unordered_map>
@@ -33,6 +34,7 @@
 #include <QObject>
 #include <QCoreApplication>
 #include <QtConcurrentRun>
+#include <QThreadPool>
 #include <QFuture>
 #include <QFutureWatcher>
 #include <QIODevice>
@@ -108,6 +110,8 @@ const char *Playlist::kRowsMimetype = "application/x-strawberry-playlist-rows";
 const char *Playlist::kPlayNowMimetype = "application/x-strawberry-play-now";
 const int Playlist::kUndoStackSize = 20;
 const int Playlist::kUndoItemLimit = 500;
+const int Playlist::kRestoreChunkSize = 2000;
+const int Playlist::kBackgroundSortThreshold = 5000;
 
 namespace {
 
@@ -135,9 +139,13 @@ Playlist::Playlist(const SharedPtr<TaskManager> task_manager,
                    QObject *parent)
     : QAbstractListModel(parent),
       is_loading_(false),
+      model_mutation_count_(0),
+      cached_total_length_nanosec_(0),
+      cached_total_length_mutation_count_(std::numeric_limits<quint64>::max()),
       filter_(new PlaylistFilter(this)),
       queue_(new Queue(this, this)),
       timer_save_(new QTimer(this)),
+      timer_save_max_(new QTimer(this)),
       task_manager_(task_manager),
       url_handlers_(url_handlers),
       playlist_backend_(playlist_backend),
@@ -182,6 +190,10 @@ Playlist::Playlist(const SharedPtr<TaskManager> task_manager,
   timer_save_->setSingleShot(true);
   timer_save_->setInterval(900ms);
 
+  timer_save_max_->setSingleShot(true);
+  timer_save_max_->setInterval(10s);
+  QObject::connect(timer_save_max_, &QTimer::timeout, this, &Playlist::Save);
+
 }
 
 Playlist::~Playlist() {
@@ -949,11 +961,15 @@ void Playlist::TurnOnDynamicPlaylist(PlaylistGeneratorPtr gen) {
 }
 
 void Playlist::MoveItemWithoutUndo(const int source, const int dest) {
+
+  ++model_mutation_count_;
   MoveItemsWithoutUndo(QList<int>() << source, dest);
 }
 
 void Playlist::MoveItemsWithoutUndo(const QList<int> &source_rows, int pos) {
 
+  ++model_mutation_count_;
+
   Q_EMIT layoutAboutToBeChanged();
 
   PlaylistItemPtrList old_items = items_;
@@ -1024,6 +1040,8 @@ void Playlist::MoveItemsWithoutUndo(const QList<int> &source_rows, int pos) {
 
 void Playlist::MoveItemsWithoutUndo(int start, const QList<int> &dest_rows) {
 
+  ++model_mutation_count_;
+
   Q_EMIT layoutAboutToBeChanged();
 
   PlaylistItemPtrList old_items = items_;
@@ -1122,6 +1140,8 @@ void Playlist::InsertItemsWithoutUndo(const PlaylistItemPtrList &items, const in
 
   if (items.isEmpty()) return;
 
+  ++model_mutation_count_;
+
   const int start = pos == -1 ? static_cast<int>(items_.count()) : pos;
   const int end = start + static_cast<int>(items.count()) - 1;
 
@@ -1229,7 +1249,12 @@ void Playlist::InsertRadioItems(const SongList &songs, const int pos, const bool
 
 }
 
-void Playlist::UpdateItems(SongList songs) {
+void Playlist::UpdateItems(const SongList &songs_in) {
+
+  // Metadata updates can change track lengths, treat them as a mutation for the cached statistics.
+  ++model_mutation_count_;
+
+  SongList songs = songs_in;
 
   qLog(Debug) << "Updating playlist with new tracks' info";
 
@@ -1453,6 +1478,22 @@ QString Playlist::abbreviated_column_name(const Column column) {
 
 }
 
+void Playlist::SortItems(const Column column, const Qt::SortOrder order, const int begin_offset, PlaylistItemPtrList *items) {
+
+  PlaylistItemPtrList::iterator begin = items->begin() + begin_offset;
+
+  if (column == Column::Album) {
+    // When sorting by album, also take into account discs and tracks.
+    std::stable_sort(begin, items->end(), std::bind(&Playlist::CompareItems, Column::Track, order, std::placeholders::_1, std::placeholders::_2));
+    std::stable_sort(begin, items->end(), std::bind(&Playlist::CompareItems, Column::Disc, order, std::placeholders::_1, std::placeholders::_2));
+    std::stable_sort(begin, items->end(), std::bind(&Playlist::CompareItems, Column::Album, order, std::placeholders::_1, std::placeholders::_2));
+  }
+  else {
+    std::stable_sort(begin, items->end(), std::bind(&Playlist::CompareItems, column, order, std::placeholders::_1, std::placeholders::_2));
+  }
+
+}
+
 void Playlist::sort(const int column_number, const Qt::SortOrder order) {
 
   const Column column = static_cast<Column>(column_number);
@@ -1463,27 +1504,41 @@ void Playlist::sort(const int column_number, const Qt::SortOrder order) {
   if (ignore_sorting_) return;
 
   PlaylistItemPtrList new_items(items_);
-  PlaylistItemPtrList::iterator begin = new_items.begin();
 
-  if (dynamic_playlist_ && current_item_index_.isValid())
-    begin += current_item_index_.row() + 1;
-
-  if (column == Column::Album) {
-    // When sorting by album, also take into account discs and tracks.
-    std::stable_sort(begin, new_items.end(), std::bind(&Playlist::CompareItems, Column::Track, order, std::placeholders::_1, std::placeholders::_2));
-    std::stable_sort(begin, new_items.end(), std::bind(&Playlist::CompareItems, Column::Disc, order, std::placeholders::_1, std::placeholders::_2));
-    std::stable_sort(begin, new_items.end(), std::bind(&Playlist::CompareItems, Column::Album, order, std::placeholders::_1, std::placeholders::_2));
-  }
-  else {
-    std::stable_sort(begin, new_items.end(), std::bind(&Playlist::CompareItems, column, order, std::placeholders::_1, std::placeholders::_2));
+  int begin_offset = 0;
+  if (dynamic_playlist_ && current_item_index_.isValid()) {
+    begin_offset = current_item_index_.row() + 1;
+  }
+
+  // Comparing song metadata per pair gets expensive on big playlists, so sort those on a background thread
+  // and apply the result when it's done, unless the playlist changed in the meantime.
+  if (new_items.count() >= kBackgroundSortThreshold) {
+    const quint64 mutation_count = model_mutation_count_;
+    QFuture<PlaylistItemPtrList> future = QtConcurrent::run([new_items, column, order, begin_offset]() mutable {
+      SortItems(column, order, begin_offset, &new_items);
+      return new_items;
+    });
+    QFutureWatcher<PlaylistItemPtrList> *watcher = new QFutureWatcher<PlaylistItemPtrList>(this);
+    QObject::connect(watcher, &QFutureWatcher<PlaylistItemPtrList>::finished, this, [this, watcher, column, order, mutation_count]() {
+      const PlaylistItemPtrList sorted_items = watcher->result();
+      watcher->deleteLater();
+      if (model_mutation_count_ != mutation_count) return;
+      undo_stack_->push(new PlaylistUndoCommandSortItems(this, column, order, sorted_items));
+    });
+    watcher->setFuture(future);
+    return;
   }
 
+  SortItems(column, order, begin_offset, &new_items);
+
   undo_stack_->push(new PlaylistUndoCommandSortItems(this, column, order, new_items));
 
 }
 
 void Playlist::ReOrderWithoutUndo(const PlaylistItemPtrList &new_items) {
 
+  ++model_mutation_count_;
+
   Q_EMIT layoutAboutToBeChanged();
 
   PlaylistItemPtrList old_items = items_;
@@ -1500,11 +1555,11 @@ void Playlist::ReOrderWithoutUndo(const PlaylistItemPtrList &new_items) {
     changePersistentIndex(idx, index(new_rows[item], idx.column(), idx.parent()));
   }
 
-  // Update virtual items
+  // Update virtual items, reusing the row mapping built above instead of a linear search per entry.
   if (ShuffleMode() != PlaylistSequence::ShuffleMode::Off) {
     const QList<int> old_virtual_items = virtual_items_;
     for (int i = 0; i < virtual_items_.count(); ++i) {
-      virtual_items_[i] = static_cast<int>(items_.indexOf(old_items[old_virtual_items[i]]));
+      virtual_items_[i] = new_rows.value(&*old_items[old_virtual_items[i]]);
     }
   }
 
@@ -1557,7 +1612,12 @@ void Playlist::ScheduleSave() {
 
   if (!playlist_backend_ || is_loading_) return;
 
+  // The debounce timer restarts on every change; the max timer keeps its deadline so a long
+  // editing session still snapshots the playlist every few seconds.
   timer_save_->start();
+  if (!timer_save_max_->isActive()) {
+    timer_save_max_->start();
+  }
 
 }
 
@@ -1565,6 +1625,9 @@ void Playlist::Save() {
 
   if (!playlist_backend_ || is_loading_) return;
 
+  if (timer_save_->isActive()) timer_save_->stop();
+  if (timer_save_max_->isActive()) timer_save_max_->stop();
+
   playlist_backend_->SavePlaylistAsync(id_, items_, last_played_row(), dynamic_playlist_);
 
 }
@@ -1573,12 +1636,17 @@ void Playlist::Restore() {
 
   if (!playlist_backend_) return;
 
+  ++model_mutation_count_;
   items_.clear();
   virtual_items_.clear();
   collection_items_by_id_.clear();
 
   cancel_restore_ = false;
-  QFuture<PlaylistItemPtrList> future = QtConcurrent::run(&PlaylistBackend::GetPlaylistItems, playlist_backend_, id_);
+  // Session restore kicks off one load per open playlist; run them on a small dedicated pool
+  // so they don't occupy the global pool that the collection load and cover loading need at startup.
+  static QThreadPool restore_pool;
+  restore_pool.setMaxThreadCount(2);
+  QFuture<PlaylistItemPtrList> future = QtConcurrent::run(&restore_pool, &PlaylistBackend::GetPlaylistItems, playlist_backend_, id_);
   QFutureWatcher<PlaylistItemPtrList> *watcher = new QFutureWatcher<PlaylistItemPtrList>();
   QObject::connect(watcher, &QFutureWatcher<PlaylistItemPtrList>::finished, this, &Playlist::ItemsLoaded);
   watcher->setFuture(future);
@@ -1604,9 +1672,48 @@ void Playlist::ItemsLoaded() {
   }
 
   is_loading_ = true;
+
+  // Feed very large playlists to the model in chunks so the UI stays responsive while restoring, smaller ones keep the old single insert.
+  if (items.count() > kRestoreChunkSize) {
+    restore_pending_items_ = items;
+    InsertRestoredItemsChunk();
+    return;
+  }
+
   InsertItems(items, 0);
   is_loading_ = false;
 
+  RestoreItemsFinished();
+
+}
+
+void Playlist::InsertRestoredItemsChunk() {
+
+  if (cancel_restore_) {
+    restore_pending_items_.clear();
+    is_loading_ = false;
+    return;
+  }
+
+  const PlaylistItemPtrList chunk_items = restore_pending_items_.mid(0, kRestoreChunkSize);
+  restore_pending_items_ = restore_pending_items_.mid(kRestoreChunkSize);
+
+  // Restores of this size are never undoable, mirroring what InsertItems does above the undo limit.
+  InsertItemsWithoutUndo(chunk_items, -1, false, false);
+  undo_stack_->clear();
+
+  if (restore_pending_items_.isEmpty()) {
+    is_loading_ = false;
+    RestoreItemsFinished();
+  }
+  else {
+    QMetaObject::invokeMethod(this, &Playlist::InsertRestoredItemsChunk, Qt::QueuedConnection);
+  }
+
+}
+
+void Playlist::RestoreItemsFinished() {
+
   PlaylistBackend::Playlist p = playlist_backend_->GetPlaylist(id_);
 
   // The newly loaded list of items might be shorter than it was before so look out for a bad last_played index
@@ -1648,6 +1755,8 @@ static bool DescendingIntLessThan(const int a, const int b) { return a > b; }
 
 void Playlist::RemoveItemsWithoutUndo(const QList<int> &indicesIn) {
 
+  ++model_mutation_count_;
+
   // Sort the indices descending because removing elements 'backwards' is easier - indices don't 'move' in the process.
   QList<int> indices = indicesIn;
   std::sort(indices.begin(), indices.end(), DescendingIntLessThan);
@@ -1719,6 +1828,8 @@ bool Playlist::removeRows(QList<int> &rows) {
 
 PlaylistItemPtrList Playlist::RemoveItemsWithoutUndo(const int row, const int count) {
 
+  ++model_mutation_count_;
+
   if (row < 0 || row >= items_.size() || row + count > items_.size()) {
     return PlaylistItemPtrList();
   }
@@ -1739,16 +1850,15 @@ PlaylistItemPtrList Playlist::RemoveItemsWithoutUndo(const int row, const int co
     }
   }
 
-  // Update virtual items
-  for (int i = row; i < items_.count() + count; ++i) {
-    Q_ASSERT(virtual_items_.count(i) == 1);
-    if (i >= row + count) {
-      virtual_items_[virtual_items_.indexOf(i)] = i - count;
-    }
-    else {
-      virtual_items_.removeAt(virtual_items_.indexOf(i));
-    }
+  // Update virtual items in one pass, preserving the shuffle order.
+  // The old per-row indexOf made any removal quadratic in the playlist size.
+  QList<int> new_virtual_items;
+  new_virtual_items.reserve(virtual_items_.count() - count);
+  for (const int virtual_item : std::as_const(virtual_items_)) {
+    if (virtual_item >= row && virtual_item < row + count) continue;
+    new_virtual_items << (virtual_item >= row + count ? virtual_item - count : virtual_item);
   }
+  virtual_items_ = new_virtual_items;
 
   endRemoveRows();
 
@@ -1881,6 +1991,10 @@ void Playlist::ExpandDynamicPlaylist() {
 
 void Playlist::RemoveItemsNotInQueue() {
 
+  // This shrinks the playlist without going through the undo system, so every command
+  // still on the stack refers to rows that no longer exist.
+  undo_stack_->clear();
+
   if (queue_->is_empty() && !current_item_index_.isValid()) {
     RemoveItemsWithoutUndo(0, static_cast<int>(items_.count()));
     return;
@@ -1962,7 +2076,7 @@ void Playlist::Shuffle() {
 
 namespace {
 
-bool AlbumShuffleComparator(const QMap<QString, int> &album_key_positions, const QMap<int, QString> &album_keys, const int left, const int right) {
+bool AlbumShuffleComparator(const QHash<QString, int> &album_key_positions, const QHash<int, QString> &album_keys, const int left, const int right) {
 
   const int left_pos = album_key_positions[album_keys[left]];
   const int right_pos = album_key_positions[album_keys[right]];
@@ -1992,8 +2106,8 @@ void Playlist::ReshuffleIndices() {
     }
 
     case PlaylistSequence::ShuffleMode::Albums:{
-      QMap<int, QString> album_keys;  // real index -> key
-      QSet<QString> album_key_set;    // unique keys
+      QHash<int, QString> album_keys;  // real index -> key
+      QSet<QString> album_key_set;     // unique keys
 
       // Find all the unique albums in the playlist
       for (QList<int>::const_iterator it = virtual_items_.constBegin(); it != virtual_items_.constEnd(); ++it) {
@@ -2018,7 +2132,7 @@ void Playlist::ReshuffleIndices() {
       }
 
       // Create album key -> position mapping for fast lookup
-      QMap<QString, int> album_key_positions;
+      QHash<QString, int> album_key_positions;
       for (int i = 0; i < shuffled_album_keys.count(); ++i) {
         album_key_positions[shuffled_album_keys[i]] = i;
       }
@@ -2066,11 +2180,19 @@ PlaylistItemPtrList Playlist::GetAllItems() const { return items_; }
 
 quint64 Playlist::GetTotalLength() const {
 
+  if (cached_total_length_mutation_count_ == model_mutation_count_) {
+    return cached_total_length_nanosec_;
+  }
+
   quint64 ret = 0;
   for (PlaylistItemPtr item : items_) {  // clazy:exclude=range-loop-reference
     qint64 length = item->Metadata().length_nanosec();
     if (length > 0) ret += length;
   }
+
+  cached_total_length_nanosec_ = ret;
+  cached_total_length_mutation_count_ = model_mutation_count_;
+
   return ret;
 
 }
@@ -2374,29 +2496,24 @@ void Playlist::RemoveDuplicateSongs() {
 
   QList<int> rows_to_remove;
   std::unordered_map<Song, int, SongSimilarHash, SongSimilarEqual> unique_songs;
+  unique_songs.reserve(static_cast<size_t>(items_.count()));
 
   for (int row = 0; row < items_.count(); ++row) {
     PlaylistItemPtr item = items_.value(row);
     const Song &song = item->Metadata();
 
-    bool found_duplicate = false;
-
     auto uniq_song_it = unique_songs.find(song);
     if (uniq_song_it != unique_songs.end()) {
-      const Song &uniq_song = uniq_song_it->first;
-
-      if (song.bitrate() > uniq_song.bitrate()) {
-        rows_to_remove.append(unique_songs[uniq_song]);  // clazy:exclude=reserve-candidates
-        unique_songs.erase(uniq_song);
+      if (song.bitrate() > uniq_song_it->first.bitrate()) {
+        rows_to_remove.append(uniq_song_it->second);  // clazy:exclude=reserve-candidates
+        unique_songs.erase(uniq_song_it);
         unique_songs.insert(std::make_pair(song, row));
       }
       else {
         rows_to_remove.append(row);  // clazy:exclude=reserve-candidates
       }
-      found_duplicate = true;
     }
-
-    if (!found_duplicate) {
+    else {
       unique_songs.insert(std::make_pair(song, row));
     }
   }
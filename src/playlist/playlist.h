@@ -156,8 +156,11 @@ class Playlist : public QAbstractListModel {
   static const char *kPlayNowMimetype;
   static const int kUndoStackSize;
   static const int kUndoItemLimit;
+  static const int kRestoreChunkSize;
+  static const int kBackgroundSortThreshold;
 
   static bool CompareItems(const Column column, const Qt::SortOrder order, PlaylistItemPtr a, PlaylistItemPtr b);
+  static void SortItems(const Column column, const Qt::SortOrder order, const int begin_offset, PlaylistItemPtrList *items);
 
   static QString column_name(const Column column);
   static QString abbreviated_column_name(const Column column);
@@ -290,7 +293,7 @@ class Playlist : public QAbstractListModel {
   void IgnoreSorting(const bool value) { ignore_sorting_ = value; }
 
   void ClearStreamMetadata();
-  void UpdateItems(SongList songs);
+  void UpdateItems(const SongList &songs);
 
   void Clear();
   void RemoveDuplicateSongs();
@@ -362,14 +365,25 @@ class Playlist : public QAbstractListModel {
   void SongSaveComplete(TagReaderReplyPtr reply, const QPersistentModelIndex &idx, const Song &old_metadata);
   void ItemReloadComplete(const QPersistentModelIndex &idx, const Song &old_metadata, const bool metadata_edit);
   void ItemsLoaded();
+  void InsertRestoredItemsChunk();
+  void RestoreItemsFinished();
   void ScheduleSave();
   void Save();
 
  private:
   bool is_loading_;
+  // Incremented on every structural change, a background sort started before a change discards its stale result.
+  quint64 model_mutation_count_;
+  // Total length cached per mutation generation, so the per-change summary doesn't walk all items.
+  mutable quint64 cached_total_length_nanosec_;
+  mutable quint64 cached_total_length_mutation_count_;
+  // Items from a restore still waiting to be inserted, fed to the model in chunks so huge playlists don't block the UI.
+  PlaylistItemPtrList restore_pending_items_;
   PlaylistFilter *filter_;
   Queue *queue_;
   QTimer *timer_save_;
+  // Caps how long continuous edits can keep postponing the debounced save, bounding what a crash can lose.
+  QTimer *timer_save_max_;
 
   QList<QModelIndex> temp_dequeue_change_indexes_;
 
@@ -37,9 +37,11 @@
 #include <QStringList>
 #include <QUrl>
 #include <QSqlDatabase>
+#include <QDateTime>
 
 #include "includes/shared_ptr.h"
 #include "core/database.h"
+#include "core/trace.h"
 #include "core/logging.h"
 #include "core/scopedtransaction.h"
 #include "core/song.h"
@@ -67,7 +69,8 @@ PlaylistBackend::PlaylistBackend(const SharedPtr<Database> database,
       database_(database),
       tagreader_client_(tagreader_client),
       collection_backend_(collection_backend),
-      original_thread_(nullptr) {
+      original_thread_(nullptr),
+      shared_load_state_last_used_(0) {
 
   setObjectName(QLatin1String(metaObject()->className()));
 
@@ -184,6 +187,21 @@ PlaylistBackend::Playlist PlaylistBackend::GetPlaylist(const int id) {
 
 }
 
+SharedPtr<PlaylistBackend::NewSongFromQueryState> PlaylistBackend::GetSharedLoadState() {
+
+  constexpr qint64 kStateTTLSecs = 60;
+
+  QMutexLocker l(&mutex_shared_load_state_);
+  const qint64 now = QDateTime::currentSecsSinceEpoch();
+  if (!shared_load_state_ || now - shared_load_state_last_used_ > kStateTTLSecs) {
+    shared_load_state_ = make_shared<NewSongFromQueryState>();
+  }
+  shared_load_state_last_used_ = now;
+
+  return shared_load_state_;
+
+}
+
 PlaylistItemPtrList PlaylistBackend::GetPlaylistItems(const int playlist) {
 
   PlaylistItemPtrList playlistitems;
@@ -205,8 +223,9 @@ PlaylistItemPtrList PlaylistBackend::GetPlaylistItems(const int playlist) {
       return PlaylistItemPtrList();
     }
 
-    // it's probable that we'll have a few songs associated with the same CUE, so we're caching results of parsing CUEs
-    SharedPtr<NewSongFromQueryState> state_ptr = make_shared<NewSongFromQueryState>();
+    // It's probable that we'll have a few songs associated with the same CUE, so the results of parsing CUEs are cached.
+    // The state is shared across loads so a batch restore of several playlists parses each CUE once.
+    SharedPtr<NewSongFromQueryState> state_ptr = GetSharedLoadState();
     while (q.next()) {
       playlistitems << NewPlaylistItemFromQuery(SqlRow(q), state_ptr);
     }
@@ -241,8 +260,8 @@ SongList PlaylistBackend::GetPlaylistSongs(const int playlist) {
       return SongList();
     }
 
-    // it's probable that we'll have a few songs associated with the same CUE, so we're caching results of parsing CUEs
-    SharedPtr<NewSongFromQueryState> state_ptr = make_shared<NewSongFromQueryState>();
+    // It's probable that we'll have a few songs associated with the same CUE, so the results of parsing CUEs are cached.
+    SharedPtr<NewSongFromQueryState> state_ptr = GetSharedLoadState();
     while (q.next()) {
       songs << NewSongFromQuery(SqlRow(q), state_ptr);
     }
@@ -337,35 +356,68 @@ void PlaylistBackend::SavePlaylistAsync(int playlist, const PlaylistItemPtrList
 
 void PlaylistBackend::SavePlaylist(int playlist, const PlaylistItemPtrList &items, int last_played, PlaylistGeneratorPtr dynamic) {
 
+  Tracing::ScopedTrace trace("PlaylistBackend::SavePlaylist");
+
   QMutexLocker l(database_->Mutex());
   QSqlDatabase db(database_->Connect());
 
   qLog(Debug) << "Saving playlist" << playlist;
 
-  ScopedTransaction transaction(&db);
-
-  // Clear the existing items in the playlist
+  // Compare against the items written last time, an unchanged playlist only needs its metadata updated below.
+  SongList songs;
+  songs.reserve(items.count());
+  for (PlaylistItemPtr item : items) {  // clazy:exclude=range-loop-reference
+    songs << item->Metadata();
+  }
+  bool items_changed = true;
   {
-    SqlQuery q(db);
-    q.prepare(u"DELETE FROM playlist_items WHERE playlist = :playlist"_s);
-    q.BindValue(u":playlist"_s, playlist);
-    if (!q.Exec()) {
-      database_->ReportErrors(q);
-      return;
+    QMutexLocker mutex_locker(&mutex_last_saved_songs_);
+    if (last_saved_songs_.contains(playlist)) {
+      const SongList &last_saved = last_saved_songs_[playlist];
+      if (last_saved.count() == songs.count()) {
+        items_changed = false;
+        for (qint64 i = 0; i < songs.count(); ++i) {
+          // The INSERT also writes type and collection_id, so a relinked item with identical metadata still counts as changed.
+          if (songs[i].url() != last_saved[i].url() ||
+              songs[i].source() != last_saved[i].source() ||
+              songs[i].id() != last_saved[i].id() ||
+              !songs[i].IsAllMetadataEqual(last_saved[i])) {
+            items_changed = true;
+            break;
+          }
+        }
+      }
     }
   }
 
-  // Save the new ones
-  for (PlaylistItemPtr item : items) {  // clazy:exclude=range-loop-reference
+  ScopedTransaction transaction(&db);
+
+  if (items_changed) {
+
+    // Clear the existing items in the playlist
+    {
+      SqlQuery q(db);
+      q.prepare(u"DELETE FROM playlist_items WHERE playlist = :playlist"_s);
+      q.BindValue(u":playlist"_s, playlist);
+      if (!q.Exec()) {
+        database_->ReportErrors(q);
+        return;
+      }
+    }
+
+    // Save the new ones
     SqlQuery q(db);
     q.prepare(u"INSERT INTO playlist_items (playlist, type, collection_id, "_s + Song::kColumnSpec + u") VALUES (:playlist, :type, :collection_id, "_s + Song::kBindSpec + u")"_s);
-    q.BindValue(u":playlist"_s, playlist);
-    item->BindToQuery(&q);
-
-    if (!q.Exec()) {
-      database_->ReportErrors(q);
-      return;
+    for (PlaylistItemPtr item : items) {  // clazy:exclude=range-loop-reference
+      q.BindValue(u":playlist"_s, playlist);
+      item->BindToQuery(&q);
+
+      if (!q.Exec()) {
+        database_->ReportErrors(q);
+        return;
+      }
     }
+
   }
 
   // Update the last played track number
@@ -392,6 +444,11 @@ void PlaylistBackend::SavePlaylist(int playlist, const PlaylistItemPtrList &item
 
   transaction.Commit();
 
+  if (items_changed) {
+    QMutexLocker mutex_locker(&mutex_last_saved_songs_);
+    last_saved_songs_.insert(playlist, songs);
+  }
+
 }
 
 int PlaylistBackend::CreatePlaylist(const QString &name, const QString &special_type) {
@@ -414,6 +471,11 @@ int PlaylistBackend::CreatePlaylist(const QString &name, const QString &special_
 
 void PlaylistBackend::RemovePlaylist(int id) {
 
+  {
+    QMutexLocker mutex_locker(&mutex_last_saved_songs_);
+    last_saved_songs_.remove(id);
+  }
+
   QMutexLocker l(database_->Mutex());
   QSqlDatabase db(database_->Connect());
 
@@ -98,7 +98,19 @@ class PlaylistBackend : public QObject {
     QMutex mutex_;
   };
 
+  SharedPtr<NewSongFromQueryState> GetSharedLoadState();
   Song NewSongFromQuery(const SqlRow &row, SharedPtr<NewSongFromQueryState> state);
+
+  // Snapshots of the items last written per playlist, used to skip the full rewrite when nothing changed.
+  QHash<int, SongList> last_saved_songs_;
+  QMutex mutex_last_saved_songs_;
+
+  // Shared song/cue resolution state across playlist loads, so a batch restore parses each CUE once
+  // even when songs appear in several playlists. Reset when it hasn't been used for a while.
+  SharedPtr<NewSongFromQueryState> shared_load_state_;
+  qint64 shared_load_state_last_used_;
+  QMutex mutex_shared_load_state_;
+
   PlaylistItemPtr NewPlaylistItemFromQuery(const SqlRow &row, SharedPtr<NewSongFromQueryState> state);
   PlaylistItemPtr RestoreCueData(PlaylistItemPtr item, SharedPtr<NewSongFromQueryState> state);
 
@@ -109,10 +109,6 @@ void QueuedItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &op
 
 void QueuedItemDelegate::DrawBox(QPainter *painter, const QRect line_rect, const QFont &font, const QString &text, int width, const float opacity) {
 
-  QFont smaller = font;
-  smaller.setPointSize(smaller.pointSize() - 1);
-  smaller.setBold(true);
-
   if (width == -1) {
     width = QFontMetrics(font).horizontalAdvance(text + u"  "_s);
   }
@@ -123,31 +119,50 @@ void QueuedItemDelegate::DrawBox(QPainter *painter, const QRect line_rect, const
   rect.setTop(rect.top() + kQueueBoxBorder);
   rect.setBottom(rect.bottom() - kQueueBoxBorder - 1);
 
-  QRect text_rect(rect);
-  text_rect.setBottom(text_rect.bottom() + 1);
+  // The same box is painted on every repaint of a queued row, so render it once per text/size and blend the cached pixmap.
+  const qreal device_pixel_ratio = painter->device()->devicePixelRatioF();
+  const QString cache_key = QStringLiteral("playlist-queue-box:%1:%2:%3:%4:%5").arg(text).arg(rect.width()).arg(rect.height()).arg(device_pixel_ratio).arg(font.key());
 
-  QLinearGradient gradient(rect.topLeft(), rect.bottomLeft());
-  gradient.setColorAt(0.0, kQueueBoxGradientColor1);
-  gradient.setColorAt(1.0, kQueueBoxGradientColor2);
+  QPixmap pixmap;
+  if (!QPixmapCache::find(cache_key, &pixmap)) {
 
-  painter->save();
+    QFont smaller = font;
+    smaller.setPointSize(smaller.pointSize() - 1);
+    smaller.setBold(true);
 
-  painter->setOpacity(opacity);
+    const QRect box_rect(0, 0, rect.width(), rect.height());
+
+    QLinearGradient gradient(box_rect.topLeft(), box_rect.bottomLeft());
+    gradient.setColorAt(0.0, kQueueBoxGradientColor1);
+    gradient.setColorAt(1.0, kQueueBoxGradientColor2);
+
+    pixmap = QPixmap((box_rect.size() + QSize(1, 1)) * device_pixel_ratio);
+    pixmap.setDevicePixelRatio(device_pixel_ratio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter box_painter(&pixmap);
+
+    // Turn on antialiasing
+    box_painter.setRenderHint(QPainter::Antialiasing);
+
+    // Draw the box
+    box_painter.translate(0.5, 0.5);
+    box_painter.setPen(QPen(Qt::white, 1));
+    box_painter.setBrush(gradient);
+    box_painter.drawRoundedRect(box_rect, kQueueBoxCornerRadius, kQueueBoxCornerRadius);
 
-  // Turn on antialiasing
-  painter->setRenderHint(QPainter::Antialiasing);
+    // Draw the text
+    box_painter.setFont(smaller);
+    box_painter.drawText(box_rect, Qt::AlignCenter, text);
+    box_painter.end();
 
-  // Draw the box
-  painter->translate(0.5, 0.5);
-  painter->setPen(QPen(Qt::white, 1));
-  painter->setBrush(gradient);
-  painter->drawRoundedRect(rect, kQueueBoxCornerRadius, kQueueBoxCornerRadius);
+    QPixmapCache::insert(cache_key, pixmap);
 
-  // Draw the text
-  painter->setFont(smaller);
-  painter->drawText(rect, Qt::AlignCenter, text);
-  painter->translate(-0.5, -0.5);
+  }
 
+  painter->save();
+  painter->setOpacity(opacity);
+  painter->drawPixmap(rect.topLeft(), pixmap);
   painter->restore();
 
 }
@@ -306,7 +321,14 @@ QString LengthItemDelegate::displayText(const QVariant &value, const QLocale &lo
   bool ok = false;
   qint64 nanoseconds = value.toLongLong(&ok);
 
-  if (ok && nanoseconds > 0) return Utilities::PrettyTimeNanosec(nanoseconds);
+  if (ok && nanoseconds > 0) {
+    if (const QString *cached = display_text_cache_.object(nanoseconds)) {
+      return *cached;
+    }
+    const QString text = Utilities::PrettyTimeNanosec(nanoseconds);
+    display_text_cache_.insert(nanoseconds, new QString(text));
+    return text;
+  }
   return QString();
 
 }
@@ -319,7 +341,14 @@ QString SizeItemDelegate::displayText(const QVariant &value, const QLocale &loca
   bool ok = false;
   qint64 bytes = value.toLongLong(&ok);
 
-  if (ok && bytes > 0) return Utilities::PrettySize(static_cast<quint64>(bytes));
+  if (ok && bytes > 0) {
+    if (const QString *cached = display_text_cache_.object(bytes)) {
+      return *cached;
+    }
+    const QString text = Utilities::PrettySize(static_cast<quint64>(bytes));
+    display_text_cache_.insert(bytes, new QString(text));
+    return text;
+  }
   return QString();
 
 }
@@ -335,7 +364,12 @@ QString DateItemDelegate::displayText(const QVariant &value, const QLocale &loca
     return QString();
   }
 
-  return QDateTime::fromSecsSinceEpoch(time).toString(QLocale::system().dateTimeFormat(QLocale::ShortFormat));
+  if (const QString *cached = display_text_cache_.object(time)) {
+    return *cached;
+  }
+  const QString text = QDateTime::fromSecsSinceEpoch(time).toString(QLocale::system().dateTimeFormat(QLocale::ShortFormat));
+  display_text_cache_.insert(time, new QString(text));
+  return text;
 
 }
 
@@ -27,6 +27,7 @@
 #include <QObject>
 #include <QWidget>
 #include <QAbstractItemView>
+#include <QCache>
 #include <QStyledItemDelegate>
 #include <QStyleOptionViewItem>
 #include <QTreeView>
@@ -95,24 +96,34 @@ class LengthItemDelegate : public PlaylistDelegateBase {
   Q_OBJECT
 
  public:
-  explicit LengthItemDelegate(QObject *parent) : PlaylistDelegateBase(parent) {}
+  explicit LengthItemDelegate(QObject *parent) : PlaylistDelegateBase(parent), display_text_cache_(1000) {}
   QString displayText(const QVariant &value, const QLocale &locale) const override;
+
+ private:
+  // Formatting is done on every repaint of every visible cell and lengths repeat a lot, so cache the formatted strings.
+  mutable QCache<qint64, QString> display_text_cache_;
 };
 
 class SizeItemDelegate : public PlaylistDelegateBase {
   Q_OBJECT
 
  public:
-  explicit SizeItemDelegate(QObject *parent) : PlaylistDelegateBase(parent) {}
+  explicit SizeItemDelegate(QObject *parent) : PlaylistDelegateBase(parent), display_text_cache_(1000) {}
   QString displayText(const QVariant &value, const QLocale &locale) const override;
+
+ private:
+  mutable QCache<qint64, QString> display_text_cache_;
 };
 
 class DateItemDelegate : public PlaylistDelegateBase {
   Q_OBJECT
 
  public:
-  explicit DateItemDelegate(QObject *parent) : PlaylistDelegateBase(parent) {}
+  explicit DateItemDelegate(QObject *parent) : PlaylistDelegateBase(parent), display_text_cache_(1000) {}
   QString displayText(const QVariant &value, const QLocale &locale) const override;
+
+ private:
+  mutable QCache<qint64, QString> display_text_cache_;
 };
 
 class LastPlayedItemDelegate : public PlaylistDelegateBase {
@@ -33,7 +33,9 @@
 PlaylistFilter::PlaylistFilter(QObject *parent)
     : QSortFilterProxyModel(parent),
       filter_tree_(new FilterTreeNop),
-      query_hash_(0) {
+      query_hash_(0),
+      use_previous_matched_rows_(false),
+      matched_rows_valid_(false) {
 
   setDynamicSortFilter(true);
 
@@ -41,6 +43,34 @@ PlaylistFilter::PlaylistFilter(QObject *parent)
 
 PlaylistFilter::~PlaylistFilter() = default;
 
+void PlaylistFilter::setSourceModel(QAbstractItemModel *source_model) {
+
+  if (sourceModel()) {
+    QObject::disconnect(sourceModel(), nullptr, this, nullptr);
+  }
+
+  QSortFilterProxyModel::setSourceModel(source_model);
+
+  // Row indexes recorded for the previous filter string are meaningless once the source rows move.
+  if (source_model) {
+    QObject::connect(source_model, &QAbstractItemModel::rowsInserted, this, &PlaylistFilter::InvalidateMatchedRows);
+    QObject::connect(source_model, &QAbstractItemModel::rowsRemoved, this, &PlaylistFilter::InvalidateMatchedRows);
+    QObject::connect(source_model, &QAbstractItemModel::rowsMoved, this, &PlaylistFilter::InvalidateMatchedRows);
+    QObject::connect(source_model, &QAbstractItemModel::layoutChanged, this, &PlaylistFilter::InvalidateMatchedRows);
+    QObject::connect(source_model, &QAbstractItemModel::modelReset, this, &PlaylistFilter::InvalidateMatchedRows);
+  }
+
+}
+
+void PlaylistFilter::InvalidateMatchedRows() {
+
+  matched_rows_.clear();
+  previous_matched_rows_.clear();
+  use_previous_matched_rows_ = false;
+  matched_rows_valid_ = false;
+
+}
+
 void PlaylistFilter::sort(int column, Qt::SortOrder order) {
   // Pass this through to the Playlist, it does sorting itself
   sourceModel()->sort(column, order);
@@ -57,6 +87,11 @@ bool PlaylistFilter::filterAcceptsRow(const int source_row, const QModelIndex &s
 
   if (filter_string_.isEmpty()) return true;
 
+  // Rows rejected by the previous, broader filter string can't match the refined one.
+  if (use_previous_matched_rows_ && !previous_matched_rows_.contains(source_row)) {
+    return false;
+  }
+
   size_t hash = qHash(filter_string_);
   if (hash != query_hash_) {
     FilterParser p(filter_string_);
@@ -64,13 +99,50 @@ bool PlaylistFilter::filterAcceptsRow(const int source_row, const QModelIndex &s
     query_hash_ = hash;
   }
 
-  return filter_tree_->accept(item->Metadata());
+  const bool accepted = filter_tree_->accept(item->Metadata());
+  if (accepted) {
+    matched_rows_ << source_row;
+  }
+
+  return accepted;
+
+}
+
+namespace {
+
+// Only plain search terms narrow monotonically when extended, field syntax and OR expressions do not.
+bool IsRefinableFilterString(const QString &filter_string) {
+
+  return !filter_string.contains(u':') &&
+         !filter_string.contains(u'=') &&
+         !filter_string.contains(u'<') &&
+         !filter_string.contains(u'>') &&
+         !filter_string.contains(u'"') &&
+         !filter_string.contains(u'(') &&
+         !filter_string.contains(QLatin1String("OR"));
 
 }
 
+}  // namespace
+
 void PlaylistFilter::SetFilterString(const QString &filter_string) {
 
+  use_previous_matched_rows_ = matched_rows_valid_ &&
+                               !filter_string_.isEmpty() &&
+                               filter_string.startsWith(filter_string_) &&
+                               IsRefinableFilterString(filter_string_) &&
+                               IsRefinableFilterString(filter_string);
+  if (use_previous_matched_rows_) {
+    previous_matched_rows_ = matched_rows_;
+  }
+  matched_rows_.clear();
+
   filter_string_ = filter_string;
   setFilterFixedString(filter_string);
 
+  // The full pass above evaluated every row, subsequent single-row re-evaluations must use the filter tree again.
+  use_previous_matched_rows_ = false;
+  previous_matched_rows_.clear();
+  matched_rows_valid_ = !filter_string.isEmpty();
+
 }
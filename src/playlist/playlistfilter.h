@@ -26,6 +26,7 @@
 
 #include <QSortFilterProxyModel>
 #include <QScopedPointer>
+#include <QSet>
 #include <QString>
 
 #include "filterparser/filtertree.h"
@@ -37,6 +38,8 @@ class PlaylistFilter : public QSortFilterProxyModel {
   explicit PlaylistFilter(QObject *parent = nullptr);
   ~PlaylistFilter() override;
 
+  void setSourceModel(QAbstractItemModel *source_model) override;
+
   // QAbstractItemModel
   void sort(const int column, const Qt::SortOrder order = Qt::AscendingOrder) override;
 
@@ -47,11 +50,22 @@ class PlaylistFilter : public QSortFilterProxyModel {
   void SetFilterString(const QString &filter_string);
   QString filter_string() const { return filter_string_; }
 
+ private Q_SLOTS:
+  void InvalidateMatchedRows();
+
  private:
   // Mutable because they're modified from filterAcceptsRow() const
   mutable QScopedPointer<FilterTree> filter_tree_;
   mutable size_t query_hash_;
   QString filter_string_;
+
+  // Rows matched by the current and the previous filter string.
+  // When the user extends a plain search term the new matches are a subset of the old ones,
+  // so only rows in previous_matched_rows_ need to be evaluated against the filter tree.
+  mutable QSet<int> matched_rows_;
+  mutable QSet<int> previous_matched_rows_;
+  mutable bool use_previous_matched_rows_;
+  bool matched_rows_valid_;
 };
 
 #endif  // PLAYLISTFILTER_H
@@ -42,8 +42,16 @@ void PlaylistProxyStyle::drawControl(ControlElement element, const QStyleOption
     const QString &text = header_option->text;
     const QFontMetrics &font_metrics = header_option->fontMetrics;
 
-    // Spaces added to make transition less abrupt
-    if (rect.width() < font_metrics.horizontalAdvance(text + u"  "_s)) {
+    // Spaces added to make transition less abrupt.
+    // The measured width only depends on the text and font, cache it across repaints; the cache is
+    // small enough that a font change at worst re-fills it with a handful of entries.
+    int text_width = header_text_width_cache_.value(text, -1);
+    if (text_width == -1) {
+      text_width = font_metrics.horizontalAdvance(text + u"  "_s);
+      if (header_text_width_cache_.count() > 100) header_text_width_cache_.clear();
+      header_text_width_cache_.insert(text, text_width);
+    }
+    if (rect.width() < text_width) {
       const Playlist::Column column = static_cast<Playlist::Column>(header_option->section);
       QStyleOptionHeader new_option(*header_option);
       new_option.text = Playlist::abbreviated_column_name(column);
@@ -27,6 +27,7 @@
 #include <QProxyStyle>
 #include <QCommonStyle>
 #include <QString>
+#include <QHash>
 
 #include "includes/scoped_ptr.h"
 
@@ -47,6 +48,9 @@ class PlaylistProxyStyle : public QProxyStyle {
   void drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const override;
 
  private:
+  // Measured header label widths per text, so each repaint doesn't re-shape the text.
+  mutable QHash<QString, int> header_text_width_cache_;
+
   ScopedPtr<QCommonStyle> common_style_;
 };
 
@@ -17,12 +17,54 @@
  *
  */
 
+#include <QHash>
+#include <QList>
+
 #include "playlist.h"
 #include "playlistundocommandreorderitems.h"
 
 PlaylistUndoCommandReOrderItems::PlaylistUndoCommandReOrderItems(Playlist *playlist, const PlaylistItemPtrList &new_items)
-    : PlaylistUndoCommandBase(playlist), old_items_(playlist->items_), new_items_(new_items) {}
+    : PlaylistUndoCommandBase(playlist) {
+
+  QHash<const PlaylistItem*, int> old_rows;
+  old_rows.reserve(playlist->items_.count());
+  for (int i = 0; i < playlist->items_.count(); ++i) {
+    old_rows.insert(&*playlist->items_[i], i);
+  }
+
+  permutation_.reserve(new_items.count());
+  for (int i = 0; i < new_items.count(); ++i) {
+    permutation_ << old_rows.value(&*new_items[i]);
+  }
+
+}
+
+void PlaylistUndoCommandReOrderItems::undo() {
+
+  // The permutation only makes sense against the exact item count it was recorded for.
+  if (permutation_.count() != playlist_->items_.count()) return;
+
+  // The playlist is in the "new" order here, applying the inverse permutation restores the old one.
+  const PlaylistItemPtrList current_items = playlist_->items_;
+  PlaylistItemPtrList old_items;
+  old_items.resize(current_items.count());
+  for (int i = 0; i < permutation_.count(); ++i) {
+    old_items[permutation_[i]] = current_items[i];
+  }
+  playlist_->ReOrderWithoutUndo(old_items);
+
+}
+
+void PlaylistUndoCommandReOrderItems::redo() {
+
+  if (permutation_.count() != playlist_->items_.count()) return;
 
-void PlaylistUndoCommandReOrderItems::undo() { playlist_->ReOrderWithoutUndo(old_items_); }
+  const PlaylistItemPtrList current_items = playlist_->items_;
+  PlaylistItemPtrList new_items;
+  new_items.reserve(current_items.count());
+  for (int i = 0; i < permutation_.count(); ++i) {
+    new_items << current_items[permutation_[i]];
+  }
+  playlist_->ReOrderWithoutUndo(new_items);
 
-void PlaylistUndoCommandReOrderItems::redo() { playlist_->ReOrderWithoutUndo(new_items_); }
+}
@@ -20,6 +20,8 @@
 #ifndef PLAYLISTUNDOCOMMANDREORDERITEMS_H
 #define PLAYLISTUNDOCOMMANDREORDERITEMS_H
 
+#include <QList>
+
 #include "playlistundocommandbase.h"
 #include "playlistitem.h"
 
@@ -33,8 +35,10 @@ class PlaylistUndoCommandReOrderItems : public PlaylistUndoCommandBase {
   void redo() override;
 
  private:
-  PlaylistItemPtrList old_items_;
-  PlaylistItemPtrList new_items_;
+  // Permutation mapping the old order to the new one (new_items[i] == old_items[permutation_[i]]).
+  // Stored instead of both full item lists so big sorts and shuffles stay compact on the undo stack
+  // and don't keep references to items that get removed later.
+  QList<int> permutation_;
 };
 
 #endif // PLAYLISTUNDOCOMMANDREORDERITEMS_H
@@ -46,6 +46,8 @@
 #include <QImage>
 #include <QPixmap>
 #include <QPainter>
+#include <QElapsedTimer>
+#include <QScopeGuard>
 #include <QPalette>
 #include <QColor>
 #include <QBrush>
@@ -60,6 +62,7 @@
 #include <QSettings>
 
 #include "includes/qt_blurimage.h"
+#include "core/logging.h"
 #include "core/song.h"
 #include "core/settings.h"
 #include "core/player.h"
@@ -499,8 +502,49 @@ void PlaylistView::drawTree(QPainter *painter, const QRegion &region) const {
 
 }
 
+namespace {
+
+// Opt-in audit of the row painting hot loop, enabled with STRAWBERRY_DEBUG_PAINT.
+// Counts rows painted and the time spent in drawRow, reported once a second,
+// so changes that add per-row work (or allocations that show up as time) are visible.
+class PaintAudit {
+ public:
+  static bool Enabled() {
+    static const bool enabled = !qEnvironmentVariableIsEmpty("STRAWBERRY_DEBUG_PAINT");
+    return enabled;
+  }
+  static void AddRow(const qint64 nsecs) {
+    ++rows_;
+    nsecs_ += nsecs;
+    if (!report_timer_.isValid()) report_timer_.start();
+    if (report_timer_.elapsed() >= 1000) {
+      qLog(Debug) << "Playlist paint audit:" << rows_ << "rows in" << nsecs_ / 1000000 << "ms over the last" << report_timer_.elapsed() << "ms";
+      rows_ = 0;
+      nsecs_ = 0;
+      report_timer_.restart();
+    }
+  }
+
+ private:
+  static qint64 rows_;
+  static qint64 nsecs_;
+  static QElapsedTimer report_timer_;
+};
+
+qint64 PaintAudit::rows_ = 0;
+qint64 PaintAudit::nsecs_ = 0;
+QElapsedTimer PaintAudit::report_timer_;
+
+}  // namespace
+
 void PlaylistView::drawRow(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &idx) const {
 
+  QElapsedTimer row_timer;
+  if (PaintAudit::Enabled()) row_timer.start();
+  const QScopeGuard audit_guard = qScopeGuard([&row_timer]() {
+    if (PaintAudit::Enabled()) PaintAudit::AddRow(row_timer.nsecsElapsed());
+  });
+
   QStyleOptionViewItem opt(option);
 
   bool is_current = idx.data(Playlist::Role_IsCurrent).toBool();
@@ -986,6 +1030,8 @@ void PlaylistView::JumpToLastPlayedTrack() {
 
 void PlaylistView::paintEvent(QPaintEvent *event) {
 
+  frame_time_tracer_.FrameStart();
+
   // Reimplemented to draw the background image.
   // Reimplemented also to draw the drop indicator
   // When the user is dragging some stuff over the playlist paintEvent gets called for the entire viewport every time the user moves the mouse.
@@ -1143,6 +1189,8 @@ void PlaylistView::paintEvent(QPaintEvent *event) {
 
   QTreeView::paintEvent(event);
 
+
+  frame_time_tracer_.FrameFinished(viewport(), "PlaylistView");
 }
 
 void PlaylistView::dragMoveEvent(QDragMoveEvent *event) {
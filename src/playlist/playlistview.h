@@ -47,6 +47,7 @@
 #include "covermanager/albumcoverloaderresult.h"
 #include "constants/appearancesettings.h"
 #include "playlist.h"
+#include "utilities/frametimetracer.h"
 
 class QWidget;
 class QTimer;
@@ -254,6 +255,7 @@ class PlaylistView : public QTreeView {
   int previous_background_image_y_;
 
   bool bars_enabled_;
+  mutable FrameTimeTracer frame_time_tracer_;
   bool glow_enabled_;
   bool select_track_;
   bool auto_sort_;
@@ -25,7 +25,11 @@
 
 #include <QtConcurrentRun>
 #include <QtAlgorithms>
+#include <QEventLoop>
+#include <QHash>
 #include <QList>
+#include <QString>
+#include <QStringList>
 #include <QUrl>
 
 #include "includes/shared_ptr.h"
@@ -33,6 +37,7 @@
 #include "core/urlhandlers.h"
 #include "core/taskmanager.h"
 #include "core/songloader.h"
+#include "tagreader/tagreaderclient.h"
 #include "playlist.h"
 #include "songloaderinserter.h"
 
@@ -177,7 +182,7 @@ void SongLoaderInserter::AsyncLoad() {
   int async_progress = 0;
   int async_load_id = task_manager_->StartTask(tr("Loading tracks"));
   task_manager_->SetTaskProgress(async_load_id, async_progress, pending_.count());
-  bool first_loaded = false;
+  SongLoader *first_loader = nullptr;
   for (int i = 0; i < pending_.count(); ++i) {
     SongLoader *loader = pending_.value(i);
     SongLoader::Result res = loader->LoadFilenamesBlocking();
@@ -191,11 +196,11 @@ void SongLoaderInserter::AsyncLoad() {
       continue;
     }
 
-    if (!first_loaded) {
+    if (!first_loader) {
       // Load everything from the first song.
       // It'll start playing as soon as we emit PreloadFinished, so it needs to have the duration set to show properly in the UI.
       loader->LoadMetadataBlocking();
-      first_loaded = true;
+      first_loader = loader;
     }
 
     songs_ << loader->songs();
@@ -205,18 +210,36 @@ void SongLoaderInserter::AsyncLoad() {
   Q_EMIT PreloadFinished();
 
   // Songs are inserted in playlist, now load them completely.
+  // Collection lookups resolve most songs; the files that remain are read through one tag reader batch,
+  // so the worker pool reads them in parallel and the cross-thread signalling is paid per batch instead of per file.
   async_progress = 0;
   async_load_id = task_manager_->StartTask(tr("Loading tracks info"));
-  task_manager_->SetTaskProgress(async_load_id, async_progress, songs_.count());
+  QStringList filenames;
+  for (SongLoader *loader : std::as_const(pending_)) {
+    if (loader == first_loader) continue;
+    // We already did this earlier for the first song.
+    filenames << loader->ResolveFromCollection();
+  }
+  task_manager_->SetTaskProgress(async_load_id, async_progress, filenames.count());
+  QHash<QString, Song> songs_by_filename;
+  if (!filenames.isEmpty()) {
+    TagReaderReadFilesReplyPtr reply = tagreader_client_->ReadFilesAsync(filenames);
+    QEventLoop loop;
+    QObject::connect(&*reply, &TagReaderReadFilesReply::FileFinished, &loop, [this, async_load_id, &async_progress, &songs_by_filename](const QString &filename, const Song &song, const TagReaderResult &result) {
+      if (result.success() && song.is_valid()) {
+        songs_by_filename.insert(filename, song);
+      }
+      task_manager_->SetTaskProgress(async_load_id, ++async_progress);
+    });
+    QObject::connect(&*reply, &TagReaderReadFilesReply::Finished, &loop, &QEventLoop::quit);
+    loop.exec();
+  }
   SongList songs;
-  for (int i = 0; i < pending_.count(); ++i) {
-    SongLoader *loader = pending_.value(i);
-    if (i != 0) {
-      // We already did this earlier for the first song.
-      loader->LoadMetadataBlocking();
+  for (SongLoader *loader : std::as_const(pending_)) {
+    if (loader != first_loader) {
+      loader->LoadMetadataFrom(songs_by_filename);
     }
     songs << loader->songs();
-    task_manager_->SetTaskProgress(async_load_id, songs.count());
   }
   task_manager_->SetTaskFinished(async_load_id);
 
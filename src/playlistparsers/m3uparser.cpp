@@ -21,7 +21,6 @@
 #include <QObject>
 #include <QIODevice>
 #include <QDir>
-#include <QBuffer>
 #include <QByteArray>
 #include <QString>
 #include <QStringList>
@@ -49,53 +48,49 @@ SongList M3UParser::Load(QIODevice *device, const QString &playlist_path, const
   M3UType type = M3UType::STANDARD;
   Metadata current_metadata;
 
-  QString data = QString::fromUtf8(device->readAll());
-  data.replace(u'\r', u'\n');
-  data.replace("\n\n"_L1, "\n"_L1);
-  QByteArray bytes = data.toUtf8();
-  QBuffer buffer(&bytes);
-  if (!buffer.open(QIODevice::ReadOnly)) return SongList();
-
-  QString line = QString::fromUtf8(buffer.readLine()).trimmed();
-  if (line.startsWith("#EXTM3U"_L1)) {
-    // This is in extended M3U format.
-    type = M3UType::EXTENDED;
-    line = QString::fromUtf8(buffer.readLine()).trimmed();
-  }
-
+  // Read the playlist one line at a time instead of buffering and re-encoding the whole file, these can get very large.
+  // readLine() splits on newlines, classic Mac carriage-return-only endings are handled by splitting the read line.
   SongList ret;
-  Q_FOREVER {
-    if (line.startsWith(u'#')) {
-      // Extended info or comment.
-      if (type == M3UType::EXTENDED && line.startsWith("#EXT"_L1)) {
-        if (!ParseMetadata(line, &current_metadata)) {
-          qLog(Warning) << "Failed to parse metadata: " << line;
+  bool seen_first_line = false;
+  while (!device->atEnd()) {
+    const QStringList lines = QString::fromUtf8(device->readLine()).split(u'\r', Qt::SkipEmptyParts);
+    for (const QString &current_line : lines) {
+      const QString line = current_line.trimmed();
+      if (line.isEmpty()) continue;
+      if (!seen_first_line) {
+        seen_first_line = true;
+        if (line.startsWith("#EXTM3U"_L1)) {
+          // This is in extended M3U format.
+          type = M3UType::EXTENDED;
+          continue;
         }
       }
-    }
-    else if (!line.isEmpty()) {
-      Song song = LoadSong(line, 0, 0, dir, collection_lookup);
-      if (!current_metadata.title.isEmpty()) {
-        song.set_title(current_metadata.title);
-      }
-      if (!current_metadata.artist.isEmpty()) {
-        song.set_artist(current_metadata.artist);
-      }
-      if (current_metadata.length > 0) {
-        song.set_length_nanosec(current_metadata.length);
+      if (line.startsWith(u'#')) {
+        // Extended info or comment.
+        if (type == M3UType::EXTENDED && line.startsWith("#EXT"_L1)) {
+          if (!ParseMetadata(line, &current_metadata)) {
+            qLog(Warning) << "Failed to parse metadata: " << line;
+          }
+        }
       }
-      ret << song;
+      else {
+        Song song = LoadSong(line, 0, 0, dir, collection_lookup);
+        if (!current_metadata.title.isEmpty()) {
+          song.set_title(current_metadata.title);
+        }
+        if (!current_metadata.artist.isEmpty()) {
+          song.set_artist(current_metadata.artist);
+        }
+        if (current_metadata.length > 0) {
+          song.set_length_nanosec(current_metadata.length);
+        }
+        ret << song;
 
-      current_metadata = Metadata();
-    }
-    if (buffer.atEnd()) {
-      break;
+        current_metadata = Metadata();
+      }
     }
-    line = QString::fromUtf8(buffer.readLine()).trimmed();
   }
 
-  buffer.close();
-
   return ret;
 
 }
@@ -27,6 +27,7 @@
 #include <QByteArrayList>
 #include <QString>
 #include <QUrl>
+#include <QFile>
 #include <QImage>
 #include <QImageReader>
 #include <QNetworkRequest>
@@ -55,8 +56,10 @@ constexpr int kMaxConcurrentArtistsRequests = 3;
 constexpr int kMaxConcurrentAlbumsRequests = 3;
 constexpr int kMaxConcurrentSongsRequests = 3;
 constexpr int kMaxConcurrentArtistAlbumsRequests = 3;
-constexpr int kMaxConcurrentAlbumSongsRequests = 3;
-constexpr int kMaxConcurrentAlbumCoverRequests = 1;
+// Album song expansion is one small request per album and dominates a full library fetch, so use a wider in-flight window.
+constexpr int kMaxConcurrentAlbumSongsRequests = 8;
+// Covers are small downloads from static hosts, fetching them one at a time made art the slowest part of a sync.
+constexpr int kMaxConcurrentAlbumCoverRequests = 5;
 constexpr int kFlushRequestsDelay = 200;
 }  // namespace
 
@@ -161,37 +164,41 @@ void QobuzRequest::StartRequests() {
 
 void QobuzRequest::FlushRequests() {
 
+  // The queues are independent and each enforces its own in-flight limit, so keep them all moving in the same tick
+  // instead of servicing only the first non-empty queue.
+
   if (!artists_requests_queue_.isEmpty()) {
     FlushArtistsRequests();
-    return;
   }
 
   if (!albums_requests_queue_.isEmpty()) {
     FlushAlbumsRequests();
-    return;
   }
 
   if (!artist_albums_requests_queue_.isEmpty()) {
     FlushArtistAlbumsRequests();
-    return;
   }
 
   if (!album_songs_requests_queue_.isEmpty()) {
     FlushAlbumSongsRequests();
-    return;
   }
 
   if (!songs_requests_queue_.isEmpty()) {
     FlushSongsRequests();
-    return;
   }
 
   if (!album_cover_requests_queue_.isEmpty()) {
     FlushAlbumCoverRequests();
-    return;
   }
 
-  timer_flush_requests_->stop();
+  if (artists_requests_queue_.isEmpty() &&
+      albums_requests_queue_.isEmpty() &&
+      artist_albums_requests_queue_.isEmpty() &&
+      album_songs_requests_queue_.isEmpty() &&
+      songs_requests_queue_.isEmpty() &&
+      album_cover_requests_queue_.isEmpty()) {
+    timer_flush_requests_->stop();
+  }
 
 }
 
@@ -1281,6 +1288,18 @@ void QobuzRequest::AddAlbumCoverRequest(const Song &song) {
   request.filename = CoverUtils::CoverFilePath(CoverOptions(), song.source(), song.effective_albumartist(), song.effective_album(), song.album_id(), QString(), cover_url);
   if (request.filename.isEmpty()) return;
 
+  // A previous sync already downloaded this cover to the same deterministic path, reuse it without a request.
+  if (QFile::exists(request.filename)) {
+    album_covers_requests_sent_.insert(cover_url, song.song_id());
+    while (album_covers_requests_sent_.contains(cover_url)) {
+      const QString song_id = album_covers_requests_sent_.take(cover_url);
+      if (songs_.contains(song_id)) {
+        songs_[song_id].set_art_automatic(QUrl::fromLocalFile(request.filename));
+      }
+    }
+    return;
+  }
+
   album_covers_requests_sent_.insert(cover_url, song.song_id());
   ++album_covers_requests_total_;
 
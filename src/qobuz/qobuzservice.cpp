@@ -22,6 +22,8 @@
 #include <utility>
 #include <memory>
 
+#include <chrono>
+
 #include <QObject>
 #include <QByteArray>
 #include <QPair>
@@ -57,6 +59,7 @@
 #include "qobuzstreamurlrequest.h"
 #include "constants/qobuzsettings.h"
 
+using namespace std::chrono_literals;
 using namespace Qt::Literals::StringLiterals;
 using std::make_shared;
 
@@ -161,6 +164,13 @@ QobuzService::QobuzService(const SharedPtr<TaskManager> task_manager,
 
   QobuzService::ReloadSettings();
 
+  // Warm the resolver for the API host right away, and pre-open the connection once the stored
+  // session is up, so the first stream URL resolution pays neither DNS nor the TCP/TLS handshakes.
+  NetworkAccessManager::PreResolve(QUrl(QLatin1String(kApiUrl)));
+  QTimer::singleShot(3s, this, [this]() {
+    if (authenticated()) network_->PreConnect(QUrl(QLatin1String(kApiUrl)));
+  });
+
 }
 
 QobuzService::~QobuzService() {
@@ -679,6 +689,11 @@ void QobuzService::StartSearch() {
 }
 
 void QobuzService::CancelSearch() {
+
+  // Stop a queued search and tear down the in-flight one, the request destructor aborts its network replies.
+  timer_search_delay_->stop();
+  search_request_.reset();
+
 }
 
 void QobuzService::SendSearch() {
@@ -46,7 +46,8 @@ namespace {
 constexpr char kRowsMimetype[] = "application/x-strawberry-queue-rows";
 }
 
-Queue::Queue(Playlist *playlist, QObject *parent) : QAbstractProxyModel(parent), playlist_(playlist), total_length_ns_(0) {
+Queue::Queue(Playlist *playlist, QObject *parent) : QAbstractProxyModel(parent), playlist_(playlist), total_length_ns_(0),
+      source_row_positions_dirty_(true) {
 
   signal_item_count_changed_ = QObject::connect(this, &Queue::ItemCountChanged, this, &Queue::UpdateTotalLength);
   QObject::connect(this, &Queue::TotalLengthChanged, this, &Queue::UpdateSummaryText);
@@ -55,26 +56,40 @@ Queue::Queue(Playlist *playlist, QObject *parent) : QAbstractProxyModel(parent),
 
 }
 
-QModelIndex Queue::mapFromSource(const QModelIndex &source_index) const {
+void Queue::InvalidatePositions() {
 
-  if (!source_index.isValid()) return QModelIndex();
+  source_row_positions_dirty_ = true;
+
+}
+
+void Queue::EnsurePositions() const {
 
-  const int source_row = source_index.row();
+  if (!source_row_positions_dirty_) return;
+
+  source_row_positions_.clear();
+  source_row_positions_.reserve(source_indexes_.count());
   for (int i = 0; i < source_indexes_.count(); ++i) {
-    if (source_indexes_[i].row() == source_row) {
-      return index(i, source_index.column());
-    }
+    source_row_positions_.insert(source_indexes_[i].row(), i);
   }
-  return QModelIndex();
+  source_row_positions_dirty_ = false;
+
+}
+
+QModelIndex Queue::mapFromSource(const QModelIndex &source_index) const {
+
+  if (!source_index.isValid()) return QModelIndex();
+
+  EnsurePositions();
+  const int position = source_row_positions_.value(source_index.row(), -1);
+  if (position == -1) return QModelIndex();
+  return index(position, source_index.column());
 
 }
 
 bool Queue::ContainsSourceRow(const int source_row) const {
 
-  for (int i = 0; i < source_indexes_.count(); ++i) {
-    if (source_indexes_[i].row() == source_row) return true;
-  }
-  return false;
+  EnsurePositions();
+  return source_row_positions_.contains(source_row);
 
 }
 
@@ -100,6 +115,13 @@ void Queue::setSourceModel(QAbstractItemModel *source_model) {
   QObject::connect(sourceModel(), &QAbstractItemModel::rowsRemoved, this, &Queue::SourceLayoutChanged);
   QObject::connect(sourceModel(), &QAbstractItemModel::layoutChanged, this, &Queue::SourceLayoutChanged);
 
+  // Any change that can shift source rows makes the cached positions stale, the persistent indexes update silently.
+  QObject::connect(sourceModel(), &QAbstractItemModel::rowsInserted, this, &Queue::InvalidatePositions);
+  QObject::connect(sourceModel(), &QAbstractItemModel::rowsRemoved, this, &Queue::InvalidatePositions);
+  QObject::connect(sourceModel(), &QAbstractItemModel::rowsMoved, this, &Queue::InvalidatePositions);
+  QObject::connect(sourceModel(), &QAbstractItemModel::layoutChanged, this, &Queue::InvalidatePositions);
+  QObject::connect(sourceModel(), &QAbstractItemModel::modelReset, this, &Queue::InvalidatePositions);
+
 }
 
 void Queue::SourceDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right) {
@@ -122,6 +144,7 @@ void Queue::SourceLayoutChanged() {
     if (!source_indexes_[i].isValid()) {
       beginRemoveRows(QModelIndex(), i, i);
       source_indexes_.removeAt(i);
+      source_row_positions_dirty_ = true;
       endRemoveRows();
       --i;
     }
@@ -184,6 +207,7 @@ void Queue::ToggleTracks(const QModelIndexList &source_indexes) {
       const int row = proxy_index.row();
       beginRemoveRows(QModelIndex(), row, row);
       source_indexes_.removeAt(row);
+      source_row_positions_dirty_ = true;
       endRemoveRows();
     }
     else {
@@ -206,6 +230,7 @@ void Queue::InsertFirst(const QModelIndexList &source_indexes) {
       const int row = proxy_index.row();
       beginRemoveRows(QModelIndex(), row, row);
       source_indexes_.removeAt(row);
+      source_row_positions_dirty_ = true;
       endRemoveRows();
     }
   }
@@ -216,6 +241,7 @@ void Queue::InsertFirst(const QModelIndexList &source_indexes) {
   int offset = 0;
   for (const QModelIndex &source_index : source_indexes) {
     source_indexes_.insert(offset, QPersistentModelIndex(source_index));
+    source_row_positions_dirty_ = true;
     offset++;
   }
   endInsertRows();
@@ -273,6 +299,7 @@ void Queue::Clear() {
 
   beginRemoveRows(QModelIndex(), 0, static_cast<int>(source_indexes_.count() - 1));
   source_indexes_.clear();
+  source_row_positions_dirty_ = true;
   endRemoveRows();
 
 }
@@ -287,6 +314,7 @@ void Queue::Move(const QList<int> &proxy_rows, int pos) {
   moved_items.reserve(proxy_rows.count());
   for (const int row : proxy_rows) {
     moved_items << source_indexes_.takeAt(row - offset);
+    source_row_positions_dirty_ = true;
     if (pos != -1 && pos >= row) --pos;
     ++offset;
   }
@@ -295,6 +323,7 @@ void Queue::Move(const QList<int> &proxy_rows, int pos) {
   const int start = pos == -1 ? static_cast<int>(source_indexes_.count()) : pos;
   for (int i = start; i < start + moved_items.count(); ++i) {
     source_indexes_.insert(i, moved_items[i - start]);
+    source_row_positions_dirty_ = true;
   }
 
   // Update persistent indexes
@@ -405,6 +434,7 @@ bool Queue::dropMimeData(const QMimeData *data, Qt::DropAction action, const int
       beginInsertRows(QModelIndex(), insert_point, insert_point + static_cast<int>(source_indexes.count() - 1));
       for (int i = 0; i < source_indexes.count(); ++i) {
         source_indexes_.insert(insert_point + i, source_indexes[i]);
+        source_row_positions_dirty_ = true;
       }
       endInsertRows();
     }
@@ -469,6 +499,7 @@ void Queue::Remove(QList<int> &proxy_rows) {
     const int real_row = row - removed_rows;
     beginRemoveRows(QModelIndex(), real_row, real_row);
     source_indexes_.removeAt(real_row);
+    source_row_positions_dirty_ = true;
     endRemoveRows();
     removed_rows++;
   }
@@ -28,6 +28,7 @@
 #include <QAbstractItemModel>
 #include <QAbstractProxyModel>
 #include <QList>
+#include <QHash>
 #include <QVariant>
 #include <QString>
 #include <QStringList>
@@ -86,12 +87,19 @@ class Queue : public QAbstractProxyModel {
   void SummaryTextChanged(const QString &message);
 
  private Q_SLOTS:
+  void InvalidatePositions();
+
+ private:
+  void EnsurePositions() const;
   void SourceDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right);
   void SourceLayoutChanged();
   void UpdateTotalLength();
 
  private:
   QList<QPersistentModelIndex> source_indexes_;
+  // Source row -> queue position, rebuilt lazily; PositionOf runs for every painted playlist row.
+  mutable QHash<int, int> source_row_positions_;
+  mutable bool source_row_positions_dirty_;
   const Playlist *playlist_;
   quint64 total_length_ns_;
   QMetaObject::Connection signal_item_count_changed_;
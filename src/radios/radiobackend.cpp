@@ -26,6 +26,7 @@
 #include "includes/shared_ptr.h"
 #include "core/database.h"
 #include "core/sqlquery.h"
+#include "core/scopedtransaction.h"
 #include "core/song.h"
 #include "radiobackend.h"
 #include "radiochannel.h"
@@ -68,6 +69,9 @@ void RadioBackend::AddChannels(const RadioChannelList &channels) {
   QMutexLocker l(db_->Mutex());
   QSqlDatabase db(db_->Connect());
 
+  // One transaction per batch of channels, not one autocommit per channel.
+  ScopedTransaction transaction(&db);
+
   SqlQuery q(db);
   q.prepare(u"INSERT INTO radio_channels (source, name, url, thumbnail_url) VALUES (:source, :name, :url, :thumbnail_url)"_s);
 
@@ -82,6 +86,8 @@ void RadioBackend::AddChannels(const RadioChannelList &channels) {
     }
   }
 
+  transaction.Commit();
+
   Q_EMIT NewChannels(channels);
 
 }
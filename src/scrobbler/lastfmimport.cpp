@@ -230,17 +230,19 @@ void LastFMImport::ImportData(const bool lastplayed, const bool playcount) {
 
 void LastFMImport::FlushRequests() {
 
-  if (!recent_tracks_requests_.isEmpty()) {
+  // Stay well under the Last.fm rate limit, but fetch a couple of pages from each queue in parallel per tick
+  // instead of a single page every two seconds.
+  for (int i = 0; i < 2 && !recent_tracks_requests_.isEmpty(); ++i) {
     SendGetRecentTracksRequest(recent_tracks_requests_.dequeue());
-    return;
   }
 
-  if (!top_tracks_requests_.isEmpty()) {
+  for (int i = 0; i < 2 && !top_tracks_requests_.isEmpty(); ++i) {
     SendGetTopTracksRequest(top_tracks_requests_.dequeue());
-    return;
   }
 
-  timer_flush_requests_->stop();
+  if (recent_tracks_requests_.isEmpty() && top_tracks_requests_.isEmpty()) {
+    timer_flush_requests_->stop();
+  }
 
 }
 
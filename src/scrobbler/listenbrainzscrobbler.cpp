@@ -581,7 +581,7 @@ void ListenBrainzScrobbler::Submit() {
 
 }
 
-void ListenBrainzScrobbler::ScrobbleRequestFinished(QNetworkReply *reply, ScrobblerCacheItemPtrList cache_items) {
+void ListenBrainzScrobbler::ScrobbleRequestFinished(QNetworkReply *reply, const ScrobblerCacheItemPtrList &cache_items) {
 
   if (!replies_.contains(reply)) return;
   replies_.removeAll(reply);
@@ -87,7 +87,7 @@ class ListenBrainzScrobbler : public ScrobblerService {
   void AuthenticateReplyFinished(QNetworkReply *reply);
   void RequestNewAccessToken() { RequestAccessToken(); }
   void UpdateNowPlayingRequestFinished(QNetworkReply *reply);
-  void ScrobbleRequestFinished(QNetworkReply *reply, ScrobblerCacheItemPtrList cache_items);
+  void ScrobbleRequestFinished(QNetworkReply *reply, const ScrobblerCacheItemPtrList &cache_items);
   void LoveRequestFinished(QNetworkReply *reply);
 
  private:
@@ -31,6 +31,8 @@
 #include <QIODevice>
 #include <QTextStream>
 #include <QTimer>
+#include <QtConcurrentRun>
+#include <QSaveFile>
 #include <QJsonDocument>
 #include <QJsonValue>
 #include <QJsonObject>
@@ -209,18 +211,41 @@ void ScrobblerCache::WriteCache() {
     object.insert("title"_L1, QJsonValue::fromVariant(cache_item->metadata.title));
     object.insert("track"_L1, QJsonValue::fromVariant(cache_item->metadata.track));
     object.insert("albumartist"_L1, QJsonValue::fromVariant(cache_item->metadata.albumartist));
-    object.insert("grouping"_L1, QJsonValue::fromVariant(cache_item->metadata.grouping));
-    object.insert("musicbrainz_album_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_album_artist_id));
-    object.insert("musicbrainz_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_artist_id));
-    object.insert("musicbrainz_original_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_original_artist_id));
-    object.insert("musicbrainz_album_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_album_id));
-    object.insert("musicbrainz_original_album_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_original_album_id));
-    object.insert("musicbrainz_recording_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_recording_id));
-    object.insert("musicbrainz_track_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_track_id));
-    object.insert("musicbrainz_disc_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_disc_id));
-    object.insert("musicbrainz_release_group_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_release_group_id));
-    object.insert("musicbrainz_work_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_work_id));
     object.insert("length_nanosec"_L1, QJsonValue::fromVariant(cache_item->metadata.length_nanosec));
+    // The reader treats these as optional, so leave them out when empty to keep the cache file compact.
+    if (!cache_item->metadata.grouping.isEmpty()) {
+      object.insert("grouping"_L1, QJsonValue::fromVariant(cache_item->metadata.grouping));
+    }
+    if (!cache_item->metadata.musicbrainz_album_artist_id.isEmpty()) {
+      object.insert("musicbrainz_album_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_album_artist_id));
+    }
+    if (!cache_item->metadata.musicbrainz_artist_id.isEmpty()) {
+      object.insert("musicbrainz_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_artist_id));
+    }
+    if (!cache_item->metadata.musicbrainz_original_artist_id.isEmpty()) {
+      object.insert("musicbrainz_original_artist_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_original_artist_id));
+    }
+    if (!cache_item->metadata.musicbrainz_album_id.isEmpty()) {
+      object.insert("musicbrainz_album_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_album_id));
+    }
+    if (!cache_item->metadata.musicbrainz_original_album_id.isEmpty()) {
+      object.insert("musicbrainz_original_album_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_original_album_id));
+    }
+    if (!cache_item->metadata.musicbrainz_recording_id.isEmpty()) {
+      object.insert("musicbrainz_recording_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_recording_id));
+    }
+    if (!cache_item->metadata.musicbrainz_track_id.isEmpty()) {
+      object.insert("musicbrainz_track_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_track_id));
+    }
+    if (!cache_item->metadata.musicbrainz_disc_id.isEmpty()) {
+      object.insert("musicbrainz_disc_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_disc_id));
+    }
+    if (!cache_item->metadata.musicbrainz_release_group_id.isEmpty()) {
+      object.insert("musicbrainz_release_group_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_release_group_id));
+    }
+    if (!cache_item->metadata.musicbrainz_work_id.isEmpty()) {
+      object.insert("musicbrainz_work_id"_L1, QJsonValue::fromVariant(cache_item->metadata.musicbrainz_work_id));
+    }
     array.append(QJsonValue::fromVariant(object));
   }
 
@@ -228,16 +253,18 @@ void ScrobblerCache::WriteCache() {
   object.insert("tracks"_L1, array);
   QJsonDocument doc(object);
 
-  QFile file(filename_);
-  bool result = file.open(QIODevice::WriteOnly | QIODevice::Text);
-  if (!result) {
-    qLog(Error) << "Unable to open scrobbler cache file" << filename_;
-    return;
-  }
-  QTextStream stream(&file);
-  stream.setEncoding(QStringConverter::Encoding::Utf8);
-  stream << doc.toJson();
-  file.close();
+  // Write behind: the document is already serialized, push the disk write to a worker thread.
+  const QString filename = filename_;
+  const QByteArray json_data = doc.toJson();
+  (void)QtConcurrent::run([filename, json_data]() {
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+      qLog(Error) << "Unable to open scrobbler cache file" << filename;
+      return;
+    }
+    file.write(json_data);
+    file.commit();
+  });
 
 }
 
@@ -262,15 +289,15 @@ void ScrobblerCache::Remove(ScrobblerCacheItemPtr cache_item) {
   }
 }
 
-void ScrobblerCache::ClearSent(ScrobblerCacheItemPtrList cache_items) {
+void ScrobblerCache::ClearSent(const ScrobblerCacheItemPtrList &cache_items) {
 
-  for (ScrobblerCacheItemPtr cache_item : cache_items) {
+  for (ScrobblerCacheItemPtr cache_item : cache_items) {  // clazy:exclude=range-loop-reference
     cache_item->sent = false;
   }
 
 }
 
-void ScrobblerCache::SetError(ScrobblerCacheItemPtrList cache_items) {
+void ScrobblerCache::SetError(const ScrobblerCacheItemPtrList &cache_items) {
 
   for (ScrobblerCacheItemPtr item : cache_items) {
     item->error = true;
@@ -278,9 +305,9 @@ void ScrobblerCache::SetError(ScrobblerCacheItemPtrList cache_items) {
 
 }
 
-void ScrobblerCache::Flush(ScrobblerCacheItemPtrList cache_items) {
+void ScrobblerCache::Flush(const ScrobblerCacheItemPtrList &cache_items) {
 
-  for (ScrobblerCacheItemPtr cache_item : cache_items) {
+  for (ScrobblerCacheItemPtr cache_item : cache_items) {  // clazy:exclude=range-loop-reference
     if (scrobbler_cache_.contains(cache_item)) {
       scrobbler_cache_.removeAll(cache_item);
     }
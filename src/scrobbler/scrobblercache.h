@@ -47,9 +47,9 @@ class ScrobblerCache : public QObject {
   void Remove(ScrobblerCacheItemPtr cache_item);
   int Count() const { return scrobbler_cache_.size(); };
   ScrobblerCacheItemPtrList List() const { return scrobbler_cache_; }
-  void ClearSent(ScrobblerCacheItemPtrList cache_items);
-  void SetError(ScrobblerCacheItemPtrList cache_items);
-  void Flush(ScrobblerCacheItemPtrList cache_items);
+  void ClearSent(const ScrobblerCacheItemPtrList &cache_items);
+  void SetError(const ScrobblerCacheItemPtrList &cache_items);
+  void Flush(const ScrobblerCacheItemPtrList &cache_items);
 
  public Q_SLOTS:
   void WriteCache();
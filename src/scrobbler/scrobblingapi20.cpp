@@ -533,7 +533,7 @@ void ScrobblingAPI20::Submit() {
 
 }
 
-void ScrobblingAPI20::ScrobbleRequestFinished(QNetworkReply *reply, ScrobblerCacheItemPtrList cache_items) {
+void ScrobblingAPI20::ScrobbleRequestFinished(QNetworkReply *reply, const ScrobblerCacheItemPtrList &cache_items) {
 
   if (!replies_.contains(reply)) return;
   replies_.removeAll(reply);
@@ -689,7 +689,10 @@ void ScrobblingAPI20::ScrobbleRequestFinished(QNetworkReply *reply, ScrobblerCac
 
  }
 
-  StartSubmit();
+  // After a successful chunk, keep draining the offline backlog right away instead of waiting out the submit delay between chunks.
+  if (cache_->Count() > 0) {
+    Submit();
+  }
 
 }
 
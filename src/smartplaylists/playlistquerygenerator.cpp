@@ -26,20 +26,40 @@
 #include <QString>
 
 #include "playlistquerygenerator.h"
+#include <utility>
+
 #include "collection/collectionbackend.h"
 
-PlaylistQueryGenerator::PlaylistQueryGenerator(QObject *parent) : PlaylistGenerator(parent), dynamic_(false), current_pos_(0) {}
+PlaylistQueryGenerator::PlaylistQueryGenerator(QObject *parent) : PlaylistGenerator(parent), dynamic_(false), current_pos_(0), candidate_pool_dirty_(true) {}
 
 PlaylistQueryGenerator::PlaylistQueryGenerator(const QString &name, const SmartPlaylistSearch &search, const bool dynamic, QObject *parent)
     : PlaylistGenerator(parent),
       search_(search),
       dynamic_(dynamic),
-      current_pos_(0) {
+      current_pos_(0),
+      candidate_pool_dirty_(true) {
 
   set_name(name);
 
 }
 
+void PlaylistQueryGenerator::set_collection_backend(SharedPtr<CollectionBackend> collection_backend) {
+
+  PlaylistGenerator::set_collection_backend(collection_backend);
+
+  // Collection deltas invalidate the fetched-ahead candidates so the next pull re-evaluates against the changed collection.
+  QObject::connect(&*collection_backend, &CollectionBackend::SongsAdded, this, &PlaylistQueryGenerator::CollectionChanged);
+  QObject::connect(&*collection_backend, &CollectionBackend::SongsChanged, this, &PlaylistQueryGenerator::CollectionChanged);
+  QObject::connect(&*collection_backend, &CollectionBackend::SongsDeleted, this, &PlaylistQueryGenerator::CollectionChanged);
+
+}
+
+void PlaylistQueryGenerator::CollectionChanged() {
+
+  candidate_pool_dirty_ = true;
+
+}
+
 void PlaylistQueryGenerator::Load(const SmartPlaylistSearch &search) {
 
   search_ = search;
@@ -67,16 +87,69 @@ QByteArray PlaylistQueryGenerator::Save() const {
 
 }
 
+void PlaylistQueryGenerator::RefillCandidatePool(const int count) {
+
+  SmartPlaylistSearch search_copy = search_;
+  search_copy.id_not_in_ = previous_ids_;
+  for (PlaylistItemPtr item : std::as_const(candidate_pool_)) {  // clazy:exclude=range-loop-reference
+    search_copy.id_not_in_ << item->Metadata().id();
+  }
+  search_copy.limit_ = qMax(count * 10, 50);
+  if (search_copy.sort_type_ != SmartPlaylistSearch::SortType::Random) {
+    search_copy.first_item_ = current_pos_ + static_cast<int>(candidate_pool_.count());
+  }
+
+  const SongList songs = collection_backend_->ExecuteQuery(search_copy.ToSql(collection_backend_->songs_table()));
+  candidate_pool_.reserve(candidate_pool_.count() + songs.count());
+  for (const Song &song : songs) {
+    candidate_pool_ << PlaylistItem::NewFromSong(song);
+  }
+  candidate_pool_dirty_ = false;
+
+}
+
 PlaylistItemPtrList PlaylistQueryGenerator::Generate() {
 
   previous_ids_.clear();
   current_pos_ = 0;
+  candidate_pool_.clear();
+  candidate_pool_dirty_ = true;
   return GenerateMore(0);
 
 }
 
 PlaylistItemPtrList PlaylistQueryGenerator::GenerateMore(const int count) {
 
+  // Small dynamic-mode pulls are served from the candidate pool, which is refilled with a bigger batch
+  // when it runs out or when the collection changed since it was filled.
+  if (dynamic_ && count > 0) {
+    if (candidate_pool_dirty_ || candidate_pool_.count() < count) {
+      candidate_pool_.clear();
+      RefillCandidatePool(count);
+    }
+
+    PlaylistItemPtrList items;
+    items.reserve(count);
+    while (!candidate_pool_.isEmpty() && items.count() < count) {
+      PlaylistItemPtr item = candidate_pool_.takeFirst();
+      items << item;
+      previous_ids_ << item->Metadata().id();
+      if (search_.sort_type_ != SmartPlaylistSearch::SortType::Random) {
+        ++current_pos_;
+      }
+      if (previous_ids_.count() > GetDynamicFuture() + GetDynamicHistory()) {
+        previous_ids_.removeFirst();
+      }
+    }
+
+    // Top the pool back up while we're already on a worker thread, so the next pull is served without a query.
+    if (!candidate_pool_dirty_ && candidate_pool_.count() < count) {
+      RefillCandidatePool(count);
+    }
+
+    return items;
+  }
+
   SmartPlaylistSearch search_copy = search_;
   search_copy.id_not_in_ = previous_ids_;
   if (count > 0) {
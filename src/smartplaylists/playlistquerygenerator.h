@@ -43,6 +43,8 @@ class PlaylistQueryGenerator : public PlaylistGenerator {
   void Load(const QByteArray &data) override;
   QByteArray Save() const override;
 
+  void set_collection_backend(SharedPtr<CollectionBackend> collection_backend) override;
+
   PlaylistItemPtrList Generate() override;
   PlaylistItemPtrList GenerateMore(const int count) override;
   bool is_dynamic() const override { return dynamic_; }
@@ -51,12 +53,23 @@ class PlaylistQueryGenerator : public PlaylistGenerator {
   SmartPlaylistSearch search() const { return search_; }
   int GetDynamicFuture() override { return search_.limit_; }
 
+ private Q_SLOTS:
+  void CollectionChanged();
+
+ private:
+  void RefillCandidatePool(const int count);
+
  private:
   SmartPlaylistSearch search_;
   bool dynamic_;
 
   QList<int> previous_ids_;
   int current_pos_;
+
+  // Candidates fetched ahead of need; refilled when exhausted or when the collection changed since it was filled,
+  // so dynamic mode doesn't run the search query for every pulled song.
+  PlaylistItemPtrList candidate_pool_;
+  bool candidate_pool_dirty_;
 };
 
 #endif  // PLAYLISTQUERYGENERATOR_H
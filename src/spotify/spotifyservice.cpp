@@ -160,6 +160,13 @@ SpotifyService::SpotifyService(const SharedPtr<TaskManager> task_manager,
   SpotifyService::ReloadSettings();
   LoadSession();
 
+  // Warm the resolver for the API host right away, and pre-open the connection once the stored
+  // session is up, so the first stream URL resolution pays neither DNS nor the TCP/TLS handshakes.
+  NetworkAccessManager::PreResolve(QUrl(QLatin1String(kApiUrl)));
+  QTimer::singleShot(3s, this, [this]() {
+    if (authenticated()) network_->PreConnect(QUrl(QLatin1String(kApiUrl)));
+  });
+
 }
 
 SpotifyService::~SpotifyService() {
@@ -690,6 +697,11 @@ void SpotifyService::StartSearch() {
 }
 
 void SpotifyService::CancelSearch() {
+
+  // Stop a queued search and tear down the in-flight one, the request destructor aborts its network replies.
+  timer_search_delay_->stop();
+  search_request_.reset();
+
 }
 
 void SpotifyService::SendSearch() {
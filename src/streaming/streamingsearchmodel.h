@@ -32,6 +32,7 @@
 #include <QSet>
 #include <QList>
 #include <QMap>
+#include <QHash>
 #include <QString>
 #include <QIcon>
 #include <QPixmap>
@@ -93,13 +94,21 @@ class StreamingSearchModel : public QStandardItemModel {
   QIcon album_icon_;
   QPixmap no_cover_icon_;
   CollectionModel::Grouping group_by_;
-  QMap<ContainerKey, QStandardItem*> containers_;
+  QHash<ContainerKey, QStandardItem*> containers_;
 };
 
 inline size_t qHash(const StreamingSearchModel::ContainerKey &key) {
   return qHash(key.group_[0]) ^ qHash(key.group_[1]) ^ qHash(key.group_[2]);
 }
 
+inline bool operator==(const StreamingSearchModel::ContainerKey &left, const StreamingSearchModel::ContainerKey &right) {
+  return left.group_[0] == right.group_[0] && left.group_[1] == right.group_[1] && left.group_[2] == right.group_[2];
+}
+
+inline size_t qHash(const StreamingSearchModel::ContainerKey &key, const size_t seed = 0) {
+  return qHashMulti(seed, key.group_[0], key.group_[1], key.group_[2]);
+}
+
 inline bool operator<(const StreamingSearchModel::ContainerKey &left, const StreamingSearchModel::ContainerKey &right) {
 #define CMP(field)                           \
   if (left.field < right.field) return true; \
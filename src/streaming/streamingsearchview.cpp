@@ -37,6 +37,7 @@
 #include <QList>
 #include <QMap>
 #include <QString>
+#include <QDateTime>
 #include <QStringList>
 #include <QRegularExpression>
 #include <QPixmap>
@@ -430,6 +431,8 @@ void StreamingSearchView::SwapModels() {
     ui_->results_stack->setCurrentWidget(ui_->results_page);
   }
 
+  QTimer::singleShot(100, this, qOverload<>(&StreamingSearchView::PrefetchAlbumCovers));
+
 }
 
 QStringList StreamingSearchView::TokenizeQuery(const QString &query) {
@@ -479,23 +482,27 @@ int StreamingSearchView::SearchAsync(const QString &query, const SearchType type
 
 void StreamingSearchView::SearchAsync(const int id, const QString &query, const SearchType type) {
 
+  // Serve a repeated query from the cache while it's fresh, so going back and forth between queries doesn't hit the service again.
+  constexpr qint64 kSearchCacheTTLSecs = 600;
+  const QString cache_key = QString::number(static_cast<int>(type)) + QLatin1Char('|') + query;
+  if (search_cache_.contains(cache_key)) {
+    const CachedSearch cached = search_cache_[cache_key];
+    if (QDateTime::currentSecsSinceEpoch() - cached.timestamp <= kSearchCacheTTLSecs) {
+      QMetaObject::invokeMethod(this, [this, id, cached]() {
+        AddResults(id, ResultsFromSongs(cached.songs));
+      }, Qt::QueuedConnection);
+      return;
+    }
+    search_cache_.remove(cache_key);
+  }
+
   const int service_id = service_->Search(query, type);
   pending_searches_[service_id] = PendingState(id, TokenizeQuery(query));
+  search_queries_[service_id] = cache_key;
 
 }
 
-void StreamingSearchView::SearchDone(const int service_id, const SongMap &songs, const QString &error) {
-
-  if (!pending_searches_.contains(service_id)) return;
-
-  // Map back to the original id.
-  const PendingState state = pending_searches_.take(service_id);
-  const int search_id = state.orig_id_;
-
-  if (songs.isEmpty()) {
-    SearchError(search_id, error);
-    return;
-  }
+StreamingSearchView::ResultList StreamingSearchView::ResultsFromSongs(const SongMap &songs) {
 
   ResultList results;
   results.reserve(songs.count());
@@ -510,7 +517,32 @@ void StreamingSearchView::SearchDone(const int service_id, const SongMap &songs,
     it->pixmap_cache_key_ = PixmapCacheKey(*it);
   }
 
-  AddResults(search_id, results);
+  return results;
+
+}
+
+void StreamingSearchView::SearchDone(const int service_id, const SongMap &songs, const QString &error) {
+
+  if (!pending_searches_.contains(service_id)) return;
+
+  // Map back to the original id.
+  const PendingState state = pending_searches_.take(service_id);
+  const int search_id = state.orig_id_;
+
+  if (search_queries_.contains(service_id) && !songs.isEmpty()) {
+    CachedSearch cached;
+    cached.timestamp = QDateTime::currentSecsSinceEpoch();
+    cached.songs = songs;
+    search_cache_.insert(search_queries_.value(service_id), cached);
+  }
+  search_queries_.remove(service_id);
+
+  if (songs.isEmpty()) {
+    SearchError(search_id, error);
+    return;
+  }
+
+  AddResults(search_id, ResultsFromSongs(songs));
 
 }
 
@@ -536,6 +568,11 @@ void StreamingSearchView::AddResults(const int id, const StreamingSearchView::Re
   ui_->progressbar->hide();
   current_model_->AddResults(results);
 
+  // Until SwapModels runs, results accumulate in the back model; prefetching then would walk the previous search.
+  if (current_model_ == front_model_) {
+    QTimer::singleShot(100, this, qOverload<>(&StreamingSearchView::PrefetchAlbumCovers));
+  }
+
 }
 
 void StreamingSearchView::SearchError(const int id, const QString &error) {
@@ -805,6 +842,27 @@ bool StreamingSearchView::FindCachedPixmap(const StreamingSearchView::Result &re
   return QPixmapCache::find(result.pixmap_cache_key_, pixmap);
 }
 
+void StreamingSearchView::PrefetchAlbumCovers() {
+
+  // Kick off cover loads for the first screens of results ahead of painting,
+  // so the art is already in flight when rows scroll into view.
+  int budget = 200;
+  PrefetchAlbumCovers(QModelIndex(), budget);
+
+}
+
+void StreamingSearchView::PrefetchAlbumCovers(const QModelIndex &parent, int &budget) {
+
+  const int row_count = front_proxy_->rowCount(parent);
+  for (int row = 0; row < row_count && budget > 0; ++row) {
+    const QModelIndex proxy_index = front_proxy_->index(row, 0, parent);
+    --budget;
+    LazyLoadAlbumCover(proxy_index);
+    PrefetchAlbumCovers(proxy_index, budget);
+  }
+
+}
+
 void StreamingSearchView::LazyLoadAlbumCover(const QModelIndex &proxy_index) {
 
   if (!proxy_index.isValid() || proxy_index.model() != front_proxy_) {
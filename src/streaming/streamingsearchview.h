@@ -87,6 +87,8 @@ class StreamingSearchView : public QWidget {
   void FocusSearchField();
 
   void LazyLoadAlbumCover(const QModelIndex &proxy_index);
+  void PrefetchAlbumCovers();
+  void PrefetchAlbumCovers(const QModelIndex &parent, int &budget);
 
  protected:
   struct PendingState {
@@ -147,6 +149,7 @@ class StreamingSearchView : public QWidget {
   void SwapModels();
   void TextEdited(const QString &text);
   void StartSearch(const QString &query);
+  ResultList ResultsFromSongs(const SongMap &songs);
   void SearchDone(const int service_id, const SongMap &songs, const QString &error);
 
   void UpdateStatus(const int service_id, const QString &text);
@@ -210,6 +213,14 @@ class StreamingSearchView : public QWidget {
   QMap<int, DelayedSearch> delayed_searches_;
   QMap<int, PendingState> pending_searches_;
 
+  // Recently completed searches keyed by query and type, served without re-querying the service while fresh.
+  struct CachedSearch {
+    qint64 timestamp;
+    SongMap songs;
+  };
+  QMap<QString, CachedSearch> search_cache_;
+  QMap<int, QString> search_queries_;
+
   QMap<quint64, QPair<QModelIndex, QString>> cover_loader_tasks_;
 };
 Q_DECLARE_METATYPE(StreamingSearchView::Result)
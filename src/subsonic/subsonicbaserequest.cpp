@@ -187,8 +187,14 @@ QJsonObject SubsonicBaseRequest::ExtractJsonObj(QByteArray &data) {
     return QJsonObject();
   }
 
+  return ExtractJsonObj(json_doc);
+
+}
+
+QJsonObject SubsonicBaseRequest::ExtractJsonObj(const QJsonDocument &json_doc) {
+
   if (json_doc.isEmpty()) {
-    Error(u"Received empty Json document."_s, data);
+    Error(u"Received empty Json document."_s);
     return QJsonObject();
   }
 
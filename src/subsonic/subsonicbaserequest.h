@@ -33,6 +33,7 @@
 #include <QUrl>
 #include <QSslError>
 #include <QJsonObject>
+#include <QJsonDocument>
 
 #include "includes/scoped_ptr.h"
 #include "subsonicservice.h"
@@ -58,6 +59,8 @@ class SubsonicBaseRequest : public QObject {
   QNetworkReply *CreateGetRequest(const QString &ressource_name, const ParamList &params_provided) const;
   QByteArray GetReplyData(QNetworkReply *reply);
   QJsonObject ExtractJsonObj(QByteArray &data);
+  // Unwraps an already parsed document, so the expensive parse can run off the UI thread.
+  QJsonObject ExtractJsonObj(const QJsonDocument &json_doc);
 
   virtual void Error(const QString &error, const QVariant &debug = QVariant()) = 0;
   static QString ErrorsToHTML(const QStringList &errors);
@@ -35,7 +35,12 @@
 #include <QNetworkReply>
 #include <QSslConfiguration>
 #include <QSslSocket>
+#include <QtConcurrentRun>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QJsonObject>
+#include <QJsonDocument>
+#include <QJsonParseError>
 #include <QJsonArray>
 #include <QJsonValue>
 
@@ -54,7 +59,8 @@ using namespace Qt::Literals::StringLiterals;
 namespace {
 constexpr int kMaxConcurrentAlbumsRequests = 3;
 constexpr int kMaxConcurrentAlbumSongsRequests = 3;
-constexpr int kMaxConcurrentAlbumCoverRequests = 1;
+// Covers are small downloads from static hosts, fetching them one at a time made art the slowest part of a sync.
+constexpr int kMaxConcurrentAlbumCoverRequests = 5;
 }  // namespace
 
 SubsonicRequest::SubsonicRequest(SubsonicService *service, SubsonicUrlHandler *url_handler, QObject *parent)
@@ -178,7 +184,32 @@ void SubsonicRequest::AlbumsReplyReceived(QNetworkReply *reply, const int offset
     return;
   }
 
-  QJsonObject json_obj = ExtractJsonObj(data);
+  // Albums lists can be several megabytes, parse the document on a worker thread and continue when it's done.
+  QFuture<QJsonDocument> future = QtConcurrent::run([data]() {
+    QJsonParseError json_error;
+    QJsonDocument json_doc = QJsonDocument::fromJson(data, &json_error);
+    if (json_error.error != QJsonParseError::NoError) return QJsonDocument();
+    return json_doc;
+  });
+  QFutureWatcher<QJsonDocument> *watcher = new QFutureWatcher<QJsonDocument>(this);
+  QObject::connect(watcher, &QFutureWatcher<QJsonDocument>::finished, this, [this, watcher, offset_requested, size_requested]() {
+    const QJsonDocument json_doc = watcher->result();
+    watcher->deleteLater();
+    if (finished_) return;
+    if (json_doc.isNull()) {
+      Error(u"Reply from server missing Json data."_s);
+      AlbumsFinishCheck(offset_requested, size_requested);
+      return;
+    }
+    AlbumsDocumentReceived(json_doc, offset_requested, size_requested);
+  });
+  watcher->setFuture(future);
+
+}
+
+void SubsonicRequest::AlbumsDocumentReceived(const QJsonDocument &json_doc, const int offset_requested, const int size_requested) {
+
+  QJsonObject json_obj = ExtractJsonObj(json_doc);
   if (json_obj.isEmpty()) {
     AlbumsFinishCheck(offset_requested, size_requested);
     return;
@@ -656,9 +687,11 @@ QString SubsonicRequest::ParseSong(Song &song, const QJsonObject &json_obj, cons
   song.set_song_id(song_id);
   if (!album_id.isEmpty()) song.set_album_id(album_id);
   if (!artist_id.isEmpty()) song.set_artist_id(artist_id);
-  if (!album_artist.isEmpty()) song.set_albumartist(album_artist);
-  song.set_album(album);
-  song.set_artist(artist);
+  // A full-library scrape repeats the same artist and album strings across tens of thousands of songs;
+  // interning keeps one allocation per distinct value while everything is held in memory.
+  if (!album_artist.isEmpty()) song.set_albumartist(Song::Intern(album_artist));
+  song.set_album(Song::Intern(album));
+  song.set_artist(Song::Intern(artist));
   song.set_title(title);
   if (track > 0) song.set_track(track);
   if (disc > 0) song.set_disc(disc);
@@ -666,7 +699,7 @@ QString SubsonicRequest::ParseSong(Song &song, const QJsonObject &json_obj, cons
   song.set_url(url);
   song.set_length_nanosec(duration);
   if (cover_url.isValid()) song.set_art_automatic(cover_url);
-  song.set_genre(genre);
+  song.set_genre(Song::Intern(genre));
   song.set_directory_id(0);
   song.set_filetype(filetype);
   song.set_filesize(size);
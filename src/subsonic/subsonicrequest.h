@@ -36,6 +36,7 @@
 #include <QStringList>
 #include <QUrl>
 #include <QJsonObject>
+#include <QJsonDocument>
 
 #include "core/song.h"
 #include "subsonicbaserequest.h"
@@ -84,6 +85,7 @@ class SubsonicRequest : public SubsonicBaseRequest {
 
  private Q_SLOTS:
   void AlbumsReplyReceived(QNetworkReply *reply, const int offset_requested, const int size_requested);
+  void AlbumsDocumentReceived(const QJsonDocument &json_doc, const int offset_requested, const int size_requested);
   void AlbumSongsReplyReceived(QNetworkReply *reply, const QString &artist_id, const QString &album_id, const QString &album_artist);
   void AlbumCoverReceived(QNetworkReply *reply, const SubsonicRequest::AlbumCoverRequest &request);
 
@@ -19,16 +19,23 @@
 
 #include "config.h"
 
+#include <chrono>
+
 #include <QtGlobal>
 #include <QObject>
 #include <QThread>
+#include <QThreadPool>
+#include <QTimer>
 #include <QMutex>
+#include <QHash>
 #include <QByteArray>
+#include <QFile>
 #include <QString>
 #include <QImage>
 #include <QScopeGuard>
 
 #include "core/logging.h"
+#include "core/trace.h"
 #include "core/song.h"
 
 #include "tagreaderclient.h"
@@ -48,7 +55,13 @@
 #include "tagreaderloadcoverdatareply.h"
 #include "tagreaderloadcoverimagereply.h"
 
+#ifdef Q_OS_LINUX
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
 using std::dynamic_pointer_cast;
+using namespace std::chrono_literals;
 using namespace Qt::Literals::StringLiterals;
 
 TagReaderClient *TagReaderClient::sInstance = nullptr;
@@ -57,10 +70,14 @@ TagReaderClient::TagReaderClient(QObject *parent)
     : QObject(parent),
       original_thread_(thread()),
       abort_(false),
-      processing_(false) {
+      processing_(false),
+      timer_flush_saves_(nullptr) {
 
   setObjectName(QLatin1String(metaObject()->className()));
 
+  // Tag reading is mostly I/O with some parsing, a few workers keep a scan from serializing on one file at a time without saturating the machine.
+  pool_.setMaxThreadCount(qBound(1, QThread::idealThreadCount() / 2, 4));
+
   if (!sInstance) {
     sInstance = this;
   }
@@ -80,14 +97,65 @@ void TagReaderClient::Exit() {
 
   Q_ASSERT(QThread::currentThread() == thread());
 
+  // Push any held playcount and rating writes out before the workers drain.
+  if (timer_flush_saves_ && timer_flush_saves_->isActive()) {
+    timer_flush_saves_->stop();
+  }
+  FlushPendingSaves();
+
+  // abort_ is already set, so ProcessRequests() refuses to dispatch; drain the queue here so the flushed writes reach the files.
+  while (HaveRequests()) {
+    TagReaderRequestPtr request = DequeueRequest();
+    if (request) {
+      pool_.start([this, request]() {
+        ProcessRequest(request);
+        QMutexLocker l(&mutex_requests_);
+        filenames_in_flight_.remove(request->filename);
+      });
+    }
+    else {
+      // All remaining requests are for files already in flight, wait for the workers and recheck.
+      pool_.waitForDone();
+    }
+  }
+
+  pool_.waitForDone();
+
   moveToThread(original_thread_);
   Q_EMIT ExitFinished();
 
 }
 
-bool TagReaderClient::HaveRequests() const {
+#ifdef Q_OS_LINUX
+namespace {
 
-  Q_ASSERT(QThread::currentThread() == thread());
+// Hints the kernel to read the file ahead of the request that's about to need it,
+// which hides a round trip per file on network mounts during scans.
+void AdviseWillNeed(const QString &filename) {
+
+  if (filename.isEmpty()) return;
+  const int fd = open(QFile::encodeName(filename).constData(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0) {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+  }
+
+}
+
+}  // namespace
+#endif
+
+QString TagReaderClient::PeekNextRequestFilename() const {
+
+  QMutexLocker l(&mutex_requests_);
+  for (const TagReaderRequestPtr &request : requests_) {
+    if (!filenames_in_flight_.contains(request->filename)) return request->filename;
+  }
+  return QString();
+
+}
+
+bool TagReaderClient::HaveRequests() const {
 
   {
     QMutexLocker l(&mutex_requests_);
@@ -111,14 +179,46 @@ void TagReaderClient::EnqueueRequest(TagReaderRequestPtr request) {
 
 }
 
-TagReaderRequestPtr TagReaderClient::DequeueRequest() {
+template<typename RequestType>
+void TagReaderClient::EnqueueCoalescedRequest(SharedPtr<RequestType> request) {
 
-  Q_ASSERT(QThread::currentThread() == thread());
+  Q_ASSERT(QThread::currentThread() != thread());
+
+  {
+    QMutexLocker l(&mutex_requests_);
+    for (QQueue<TagReaderRequestPtr>::iterator it = requests_.begin(); it != requests_.end(); ++it) {
+      if ((*it)->filename != request->filename) continue;
+      SharedPtr<RequestType> queued_request = dynamic_pointer_cast<RequestType>(*it);
+      if (!queued_request) continue;
+      // The new value supersedes the queued one, finish the old reply and replace the request.
+      queued_request->reply->set_result(TagReaderResult(TagReaderResult::ErrorCode::Success));
+      queued_request->reply->Finish();
+      *it = request;
+      return;
+    }
+    requests_.enqueue(request);
+  }
+
+  if (!processing_.value()) {
+    ProcessRequestsAsync();
+  }
+
+}
+
+TagReaderRequestPtr TagReaderClient::DequeueRequest() {
 
   {
     QMutexLocker l(&mutex_requests_);
-    if (requests_.isEmpty()) return TagReaderRequestPtr();
-    return requests_.dequeue();
+    // Skip requests for files that are already being processed on the pool, so requests for the same file keep their order.
+    for (QQueue<TagReaderRequestPtr>::iterator it = requests_.begin(); it != requests_.end(); ++it) {
+      if (!filenames_in_flight_.contains((*it)->filename)) {
+        TagReaderRequestPtr request = *it;
+        requests_.erase(it);
+        filenames_in_flight_ << request->filename;
+        return request;
+      }
+    }
+    return TagReaderRequestPtr();
   }
 
 }
@@ -143,14 +243,32 @@ void TagReaderClient::ProcessRequests() {
 
   while (HaveRequests()) {
     if (abort_.value()) return;
-    ProcessRequest(DequeueRequest());
+    TagReaderRequestPtr request = DequeueRequest();
+    // All remaining requests are for files already in flight, the workers re-trigger processing as they finish.
+    if (!request) return;
+    pool_.start([this, request]() {
+#ifdef Q_OS_LINUX
+      AdviseWillNeed(PeekNextRequestFilename());
+#endif
+      ProcessRequest(request);
+      {
+        QMutexLocker l(&mutex_requests_);
+        filenames_in_flight_.remove(request->filename);
+      }
+      // Don't gate on processing_: it can flip to false right after we read it, stranding a queued
+      // same-file request until the next unrelated enqueue. A spare ProcessRequests() that finds
+      // nothing to dequeue is cheap.
+      if (!abort_.value() && HaveRequests()) {
+        ProcessRequestsAsync();
+      }
+    });
   }
 
 }
 
 void TagReaderClient::ProcessRequest(TagReaderRequestPtr request) {
 
-  Q_ASSERT(QThread::currentThread() == thread());
+  Tracing::ScopedTrace trace("TagReaderClient::ProcessRequest");
 
   TagReaderReplyPtr reply = request->reply;
 
@@ -235,9 +353,9 @@ TagReaderReplyPtr TagReaderClient::IsMediaFileAsync(const QString &filename) {
 
 }
 
-TagReaderResult TagReaderClient::ReadFileBlocking(const QString &filename, Song *song) {
+TagReaderResult TagReaderClient::ReadFileBlocking(const QString &filename, Song *song, const bool partial) {
 
-  return tagreader_.ReadFile(filename, song);
+  return tagreader_.ReadFile(filename, song, !partial);
 
 }
 
@@ -257,6 +375,34 @@ TagReaderReadFileReplyPtr TagReaderClient::ReadFileAsync(const QString &filename
 
 }
 
+TagReaderReadFilesReplyPtr TagReaderClient::ReadFilesAsync(const QStringList &filenames) {
+
+  Q_ASSERT(QThread::currentThread() != thread());
+
+  TagReaderReadFilesReplyPtr reply(new TagReaderReadFilesReply(filenames));
+
+  // Enqueue the whole batch before processing starts so the worker pool can pick the files up in parallel,
+  // the batch reply collects the per-file replies as they finish.
+  for (const QString &filename : filenames) {
+    TagReaderReadFileReplyPtr file_reply = TagReaderReply::Create<TagReaderReadFileReply>(filename);
+    TagReaderReadFileRequestPtr request = TagReaderReadFileRequest::Create(filename);
+    request->reply = file_reply;
+    request->filename = filename;
+    reply->AddReadFileReply(file_reply);
+    {
+      QMutexLocker l(&mutex_requests_);
+      requests_.enqueue(request);
+    }
+  }
+
+  if (!processing_.value()) {
+    ProcessRequestsAsync();
+  }
+
+  return reply;
+
+}
+
 TagReaderResult TagReaderClient::WriteFileBlocking(const QString &filename, const Song &song, const SaveTagsOptions save_tags_options, const SaveTagCoverData &save_tag_cover_data) {
 
   return tagreader_.WriteFile(filename, song, save_tags_options, save_tag_cover_data);
@@ -367,7 +513,7 @@ TagReaderReplyPtr TagReaderClient::SaveSongPlaycountAsync(const QString &filenam
   request->filename = filename;
   request->playcount = playcount;
 
-  EnqueueRequest(request);
+  EnqueueCoalescedRequest(request);
 
   return reply;
 
@@ -383,10 +529,16 @@ void TagReaderClient::SaveSongsPlaycountAsync(const SongList &songs) {
 
   Q_ASSERT(QThread::currentThread() != thread());
 
-  for (const Song &song : songs) {
-    SaveSongPlaycountAsync(song.url().toLocalFile(), song.playcount());
+  // Write-behind: only the latest value per file is kept, and it's flushed on a timer or at shutdown.
+  {
+    QMutexLocker l(&mutex_pending_saves_);
+    for (const Song &song : songs) {
+      pending_playcounts_.insert(song.url().toLocalFile(), song.playcount());
+    }
   }
 
+  QMetaObject::invokeMethod(this, &TagReaderClient::ScheduleSaveFlush, Qt::QueuedConnection);
+
 }
 
 TagReaderResult TagReaderClient::SaveSongRatingBlocking(const QString &filename, const float rating) {
@@ -406,7 +558,7 @@ TagReaderReplyPtr TagReaderClient::SaveSongRatingAsync(const QString &filename,
   request->filename = filename;
   request->rating = rating;
 
-  EnqueueRequest(request);
+  EnqueueCoalescedRequest(request);
 
   return reply;
 
@@ -416,8 +568,69 @@ void TagReaderClient::SaveSongsRatingAsync(const SongList &songs) {
 
   Q_ASSERT(QThread::currentThread() != thread());
 
-  for (const Song &song : songs) {
-    SaveSongRatingAsync(song.url().toLocalFile(), song.rating());
+  {
+    QMutexLocker l(&mutex_pending_saves_);
+    for (const Song &song : songs) {
+      pending_ratings_.insert(song.url().toLocalFile(), song.rating());
+    }
+  }
+
+  QMetaObject::invokeMethod(this, &TagReaderClient::ScheduleSaveFlush, Qt::QueuedConnection);
+
+}
+
+void TagReaderClient::ScheduleSaveFlush() {
+
+  Q_ASSERT(QThread::currentThread() == thread());
+
+  if (!timer_flush_saves_) {
+    timer_flush_saves_ = new QTimer(this);
+    timer_flush_saves_->setSingleShot(true);
+    timer_flush_saves_->setInterval(5min);
+    QObject::connect(timer_flush_saves_, &QTimer::timeout, this, &TagReaderClient::FlushPendingSaves);
+  }
+  if (!timer_flush_saves_->isActive()) {
+    timer_flush_saves_->start();
+  }
+
+}
+
+void TagReaderClient::FlushPendingSaves() {
+
+  Q_ASSERT(QThread::currentThread() == thread());
+
+  QHash<QString, uint> playcounts;
+  QHash<QString, float> ratings;
+  {
+    QMutexLocker l(&mutex_pending_saves_);
+    playcounts = pending_playcounts_;
+    ratings = pending_ratings_;
+    pending_playcounts_.clear();
+    pending_ratings_.clear();
+  }
+
+  if (playcounts.isEmpty() && ratings.isEmpty()) return;
+
+  {
+    QMutexLocker l(&mutex_requests_);
+    for (QHash<QString, uint>::const_iterator it = playcounts.constBegin(); it != playcounts.constEnd(); ++it) {
+      TagReaderSavePlaycountRequestPtr request = TagReaderSavePlaycountRequest::Create(it.key());
+      request->reply = TagReaderReply::Create<TagReaderReply>(it.key());
+      request->filename = it.key();
+      request->playcount = it.value();
+      requests_.enqueue(request);
+    }
+    for (QHash<QString, float>::const_iterator it = ratings.constBegin(); it != ratings.constEnd(); ++it) {
+      TagReaderSaveRatingRequestPtr request = TagReaderSaveRatingRequest::Create(it.key());
+      request->reply = TagReaderReply::Create<TagReaderReply>(it.key());
+      request->filename = it.key();
+      request->rating = it.value();
+      requests_.enqueue(request);
+    }
+  }
+
+  if (!processing_.value()) {
+    ProcessRequests();
   }
 
 }
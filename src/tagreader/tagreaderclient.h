@@ -25,9 +25,12 @@
 #include <QObject>
 #include <QList>
 #include <QQueue>
+#include <QSet>
+#include <QHash>
 #include <QString>
 #include <QImage>
 #include <QMutex>
+#include <QThreadPool>
 
 #include "includes/shared_ptr.h"
 #include "includes/mutex_protected.h"
@@ -39,12 +42,14 @@
 #include "tagreaderresult.h"
 #include "tagreaderreply.h"
 #include "tagreaderreadfilereply.h"
+#include "tagreaderreadfilesreply.h"
 #include "tagreaderloadcoverdatareply.h"
 #include "tagreaderloadcoverimagereply.h"
 #include "savetagsoptions.h"
 #include "savetagcoverdata.h"
 
 class QThread;
+class QTimer;
 class Song;
 
 class TagReaderClient : public QObject {
@@ -64,8 +69,9 @@ class TagReaderClient : public QObject {
   bool IsMediaFileBlocking(const QString &filename) const;
   TagReaderReplyPtr IsMediaFileAsync(const QString &filename);
 
-  TagReaderResult ReadFileBlocking(const QString &filename, Song *song);
+  TagReaderResult ReadFileBlocking(const QString &filename, Song *song, const bool partial = false);
   TagReaderReadFileReplyPtr ReadFileAsync(const QString &filename);
+  TagReaderReadFilesReplyPtr ReadFilesAsync(const QStringList &filenames);
 
   TagReaderResult WriteFileBlocking(const QString &filename, const Song &song, const SaveTagsOptions save_tags_options = SaveTagsOption::Tags, const SaveTagCoverData &save_tag_cover_data = SaveTagCoverData());
   TagReaderReplyPtr WriteFileAsync(const QString &filename, const Song &song, const SaveTagsOptions save_tags_options = SaveTagsOption::Tags, const SaveTagCoverData &save_tag_cover_data = SaveTagCoverData());
@@ -86,7 +92,12 @@ class TagReaderClient : public QObject {
 
  private:
   bool HaveRequests() const;
+  QString PeekNextRequestFilename() const;
   void EnqueueRequest(TagReaderRequestPtr request);
+  // Replaces a queued request of the same type for the same file, completing the superseded reply;
+  // rapid playcount or rating updates then result in one tag write instead of one per change.
+  template<typename RequestType>
+  void EnqueueCoalescedRequest(SharedPtr<RequestType> request);
   TagReaderRequestPtr DequeueRequest();
   void ProcessRequestsAsync();
   void ProcessRequest(TagReaderRequestPtr request);
@@ -97,6 +108,8 @@ class TagReaderClient : public QObject {
  private Q_SLOTS:
   void Exit();
   void ProcessRequests();
+  void ScheduleSaveFlush();
+  void FlushPendingSaves();
 
  public Q_SLOTS:
   void SaveSongsPlaycountAsync(const SongList &songs);
@@ -107,7 +120,17 @@ class TagReaderClient : public QObject {
 
   QThread *original_thread_;
   QQueue<TagReaderRequestPtr> requests_;
+  // Filenames with a request currently running on the pool. Requests for the same file stay queued so they execute in order.
+  QSet<QString> filenames_in_flight_;
   mutable QMutex mutex_requests_;
+  QThreadPool pool_;
+
+  // Write-behind queue for playcount and rating tag writes: the latest value per file is held here and
+  // flushed periodically and at shutdown, so a listening session rewrites each file's tag once, not per play.
+  QHash<QString, uint> pending_playcounts_;
+  QHash<QString, float> pending_ratings_;
+  QMutex mutex_pending_saves_;
+  QTimer *timer_flush_saves_;
   TagReaderTagLib tagreader_;
   TagReaderGME gmereader_;
   mutex_protected<bool> abort_;
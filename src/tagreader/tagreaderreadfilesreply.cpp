@@ -0,0 +1,68 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <QString>
+#include <QStringList>
+
+#include "core/logging.h"
+#include "tagreaderreadfilesreply.h"
+
+TagReaderReadFilesReply::TagReaderReadFilesReply(const QStringList &filenames, QObject *parent)
+    : QObject(parent),
+      filenames_(filenames),
+      remaining_(filenames.count()) {
+
+  qLog(Debug) << "New tagreader batch reply for" << filenames_.count() << "files";
+
+  songs_.reserve(filenames_.count());
+
+  if (filenames_.isEmpty()) {
+    QMetaObject::invokeMethod(this, [this]() { Q_EMIT Finished(songs_); }, Qt::QueuedConnection);
+  }
+
+}
+
+TagReaderReadFilesReply::~TagReaderReadFilesReply() {
+
+  qLog(Debug) << "Tagreader batch reply for" << filenames_.count() << "files deleted";
+
+}
+
+void TagReaderReadFilesReply::AddReadFileReply(TagReaderReadFileReplyPtr reply) {
+
+  replies_ << reply;
+  QObject::connect(&*reply, &TagReaderReadFileReply::Finished, this, &TagReaderReadFilesReply::ReadFileReplyFinished);
+
+}
+
+void TagReaderReadFilesReply::ReadFileReplyFinished(const QString &filename, const Song &song, const TagReaderResult &result) {
+
+  if (result.success() && song.is_valid()) {
+    songs_ << song;
+  }
+
+  Q_EMIT FileFinished(filename, song, result);
+
+  --remaining_;
+  if (remaining_ == 0) {
+    replies_.clear();
+    Q_EMIT Finished(songs_);
+  }
+
+}
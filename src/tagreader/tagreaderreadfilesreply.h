@@ -0,0 +1,64 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TAGREADERREADFILESREPLY_H
+#define TAGREADERREADFILESREPLY_H
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QSharedPointer>
+
+#include "core/song.h"
+#include "tagreaderresult.h"
+#include "tagreaderreadfilereply.h"
+
+// Aggregates the replies for a batch of ReadFile requests.
+// FileFinished is emitted as each file completes, Finished once with all successfully read songs when the whole batch is done.
+class TagReaderReadFilesReply : public QObject {
+  Q_OBJECT
+
+ public:
+  explicit TagReaderReadFilesReply(const QStringList &filenames, QObject *parent = nullptr);
+  ~TagReaderReadFilesReply() override;
+
+  QStringList filenames() const { return filenames_; }
+  SongList songs() const { return songs_; }
+  bool finished() const { return remaining_ == 0; }
+
+  void AddReadFileReply(TagReaderReadFileReplyPtr reply);
+
+ Q_SIGNALS:
+  void FileFinished(const QString &filename, const Song &song, const TagReaderResult &result);
+  void Finished(const SongList &songs);
+
+ private Q_SLOTS:
+  void ReadFileReplyFinished(const QString &filename, const Song &song, const TagReaderResult &result);
+
+ private:
+  const QStringList filenames_;
+  QList<TagReaderReadFileReplyPtr> replies_;
+  SongList songs_;
+  qint64 remaining_;
+};
+
+using TagReaderReadFilesReplyPtr = QSharedPointer<TagReaderReadFilesReply>;
+
+#endif  // TAGREADERREADFILESREPLY_H
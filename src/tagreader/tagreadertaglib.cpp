@@ -239,7 +239,7 @@ class FileRefFactory {
  public:
   FileRefFactory() = default;
   virtual ~FileRefFactory() = default;
-  virtual TagLib::FileRef *GetFileRef(const QString &filename) = 0;
+  virtual TagLib::FileRef *GetFileRef(const QString &filename, const bool read_audio_properties = true) = 0;
 
  private:
   Q_DISABLE_COPY(FileRefFactory)
@@ -248,11 +248,11 @@ class FileRefFactory {
 class TagLibFileRefFactory : public FileRefFactory {
  public:
   TagLibFileRefFactory() = default;
-  TagLib::FileRef *GetFileRef(const QString &filename) override {
+  TagLib::FileRef *GetFileRef(const QString &filename, const bool read_audio_properties) override {
 #ifdef Q_OS_WIN32
-    return new TagLib::FileRef(filename.toStdWString().c_str());
+    return new TagLib::FileRef(filename.toStdWString().c_str(), read_audio_properties);
 #else
-    return new TagLib::FileRef(QFile::encodeName(filename).constData());
+    return new TagLib::FileRef(QFile::encodeName(filename).constData(), read_audio_properties);
 #endif
   }
 
@@ -270,7 +270,8 @@ TagReaderResult TagReaderTagLib::IsMediaFile(const QString &filename) const {
 
   qLog(Debug) << "Checking for valid file" << filename;
 
-  unique_ptr<TagLib::FileRef> fileref(factory_->GetFileRef(filename));
+  // Media detection only needs the tag to resolve, skip parsing the audio properties so the scan pre-pass touches less of the file.
+  unique_ptr<TagLib::FileRef> fileref(factory_->GetFileRef(filename, false));
   return fileref &&
          !fileref->isNull() &&
          fileref->file() &&
@@ -311,6 +312,12 @@ Song::FileType TagReaderTagLib::GuessFileType(TagLib::FileRef *fileref) {
 
 TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) const {
 
+  return ReadFile(filename, song, true);
+
+}
+
+TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song, const bool read_audio_properties) const {
+
   if (filename.isEmpty()) {
     return TagReaderResult::ErrorCode::FilenameMissing;
   }
@@ -337,7 +344,7 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
   song->set_lastseen(QDateTime::currentSecsSinceEpoch());
   song->set_init_from_file(true);
 
-  unique_ptr<TagLib::FileRef> fileref(factory_->GetFileRef(filename));
+  unique_ptr<TagLib::FileRef> fileref(factory_->GetFileRef(filename, read_audio_properties));
   if (!fileref || fileref->isNull()) {
     qLog(Error) << "TagLib could not open file" << filename;
     return TagReaderResult::ErrorCode::FileOpenError;
@@ -345,7 +352,7 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
 
   song->set_filetype(GuessFileType(fileref.get()));
 
-  if (fileref->audioProperties()) {
+  if (read_audio_properties && fileref->audioProperties()) {
     song->set_bitrate(fileref->audioProperties()->bitrate());
     song->set_samplerate(fileref->audioProperties()->sampleRate());
     song->set_length_nanosec(fileref->audioProperties()->lengthInMilliseconds() * kNsecPerMsec);
@@ -382,7 +389,7 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
   }
 
   if (TagLib::FLAC::File *file_flac = dynamic_cast<TagLib::FLAC::File*>(fileref->file())) {
-    song->set_bitdepth(file_flac->audioProperties()->bitsPerSample());
+    if (file_flac->audioProperties()) song->set_bitdepth(file_flac->audioProperties()->bitsPerSample());
     if (file_flac->xiphComment()) {
       ParseVorbisComments(file_flac->xiphComment()->fieldListMap(), &disc, &compilation, song);
       TagLib::List<TagLib::FLAC::Picture*> pictures = file_flac->pictureList();
@@ -401,7 +408,7 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
   }
 
   else if (TagLib::WavPack::File *file_wavpack = dynamic_cast<TagLib::WavPack::File*>(fileref->file())) {
-    song->set_bitdepth(file_wavpack->audioProperties()->bitsPerSample());
+    if (file_wavpack->audioProperties()) song->set_bitdepth(file_wavpack->audioProperties()->bitsPerSample());
     if (file_wavpack->APETag()) {
       ParseAPETags(file_wavpack->APETag()->itemListMap(), &disc, &compilation, song);
     }
@@ -411,7 +418,7 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
   }
 
   else if (TagLib::APE::File *file_ape = dynamic_cast<TagLib::APE::File*>(fileref->file())) {
-    song->set_bitdepth(file_ape->audioProperties()->bitsPerSample());
+    if (file_ape->audioProperties()) song->set_bitdepth(file_ape->audioProperties()->bitsPerSample());
     if (file_ape->APETag()) {
       ParseAPETags(file_ape->APETag()->itemListMap(), &disc, &compilation, song);
     }
@@ -427,14 +434,14 @@ TagReaderResult TagReaderTagLib::ReadFile(const QString &filename, Song *song) c
   }
 
   else if (TagLib::MP4::File *file_mp4 = dynamic_cast<TagLib::MP4::File*>(fileref->file())) {
-    song->set_bitdepth(file_mp4->audioProperties()->bitsPerSample());
+    if (file_mp4->audioProperties()) song->set_bitdepth(file_mp4->audioProperties()->bitsPerSample());
     if (file_mp4->tag()) {
       ParseMP4Tags(file_mp4->tag(), &disc, &compilation, song);
     }
   }
 
   else if (TagLib::ASF::File *file_asf = dynamic_cast<TagLib::ASF::File*>(fileref->file())) {
-    song->set_bitdepth(file_asf->audioProperties()->bitsPerSample());
+    if (file_asf->audioProperties()) song->set_bitdepth(file_asf->audioProperties()->bitsPerSample());
     if (file_asf->tag()) {
       song->set_comment(file_asf->tag()->comment());
       ParseASFTags(file_asf->tag(), &disc, &compilation, song);
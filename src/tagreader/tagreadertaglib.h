@@ -66,6 +66,9 @@ class TagReaderTagLib : public TagReaderBase {
   TagReaderResult IsMediaFile(const QString &filename) const override;
 
   TagReaderResult ReadFile(const QString &filename, Song *song) const override;
+  // Partial re-read for cheap rescans: parses the tags but skips the audio properties,
+  // the caller keeps the previously known length, bitrate and sample rate.
+  TagReaderResult ReadFile(const QString &filename, Song *song, const bool read_audio_properties) const;
   TagReaderResult WriteFile(const QString &filename, const Song &song, const SaveTagsOptions save_tags_options, const SaveTagCoverData &save_tag_cover_data) const override;
 
   TagReaderResult LoadEmbeddedCover(const QString &filename, QByteArray &data) const override;
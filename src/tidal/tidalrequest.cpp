@@ -27,6 +27,7 @@
 #include <QByteArrayList>
 #include <QString>
 #include <QUrl>
+#include <QFile>
 #include <QImage>
 #include <QImageReader>
 #include <QNetworkRequest>
@@ -57,7 +58,8 @@ constexpr int kMaxConcurrentAlbumsRequests = 3;
 constexpr int kMaxConcurrentSongsRequests = 3;
 constexpr int kMaxConcurrentArtistAlbumsRequests = 3;
 constexpr int kMaxConcurrentAlbumSongsRequests = 3;
-constexpr int kMaxConcurrentAlbumCoverRequests = 1;
+// Covers are small downloads from static hosts, fetching them one at a time made art the slowest part of a sync.
+constexpr int kMaxConcurrentAlbumCoverRequests = 5;
 constexpr int kFlushRequestsDelay = 200;
 }  // namespace
 
@@ -532,10 +534,20 @@ void TidalRequest::ArtistsFinishCheck(const int limit, const int offset, const i
   if (finished_) return;
 
   if ((limit == 0 || limit > artists_received) && artists_received_ < artists_total_) {
-    int offset_next = offset + artists_received;
-    if (offset_next > 0 && offset_next < artists_total_) {
-      if (query_type_ == Type::FavouriteArtists) AddArtistsRequest(offset_next);
-      else if (query_type_ == Type::SearchArtists) AddArtistsSearchRequest(offset_next);
+    if (limit == 0 && offset == 0 && artists_received > 0) {
+      // The first page told us the total, so request all remaining pages at once.
+      // They are fetched concurrently, bounded by kMaxConcurrentArtistsRequests.
+      for (int offset_next = artists_received; offset_next < artists_total_; offset_next += artists_received) {
+        if (query_type_ == Type::FavouriteArtists) AddArtistsRequest(offset_next);
+        else if (query_type_ == Type::SearchArtists) AddArtistsSearchRequest(offset_next);
+      }
+    }
+    else if (limit > 0) {
+      int offset_next = offset + artists_received;
+      if (offset_next > 0 && offset_next < artists_total_) {
+        if (query_type_ == Type::FavouriteArtists) AddArtistsRequest(offset_next);
+        else if (query_type_ == Type::SearchArtists) AddArtistsSearchRequest(offset_next);
+      }
     }
   }
 
@@ -782,21 +794,42 @@ void TidalRequest::AlbumsFinishCheck(const Artist &artist, const int limit, cons
   if (finished_) return;
 
   if (limit == 0 || limit > albums_received) {
-    int offset_next = offset + albums_received;
-    if (offset_next > 0 && offset_next < albums_total) {
-      switch (query_type_) {
-        case Type::FavouriteAlbums:
-          AddAlbumsRequest(offset_next);
-          break;
-        case Type::SearchAlbums:
-          AddAlbumsSearchRequest(offset_next);
-          break;
-        case Type::FavouriteArtists:
-        case Type::SearchArtists:
-          AddArtistAlbumsRequest(artist, offset_next);
-          break;
-        default:
-          break;
+    if (limit == 0 && offset == 0 && albums_received > 0) {
+      // The first page told us the total, request the remaining pages at once so they fetch concurrently.
+      for (int offset_next = albums_received; offset_next < albums_total; offset_next += albums_received) {
+        switch (query_type_) {
+          case Type::FavouriteAlbums:
+            AddAlbumsRequest(offset_next);
+            break;
+          case Type::SearchAlbums:
+            AddAlbumsSearchRequest(offset_next);
+            break;
+          case Type::FavouriteArtists:
+          case Type::SearchArtists:
+            AddArtistAlbumsRequest(artist, offset_next);
+            break;
+          default:
+            break;
+        }
+      }
+    }
+    else if (limit > 0) {
+      int offset_next = offset + albums_received;
+      if (offset_next > 0 && offset_next < albums_total) {
+        switch (query_type_) {
+          case Type::FavouriteAlbums:
+            AddAlbumsRequest(offset_next);
+            break;
+          case Type::SearchAlbums:
+            AddAlbumsSearchRequest(offset_next);
+            break;
+          case Type::FavouriteArtists:
+          case Type::SearchArtists:
+            AddArtistAlbumsRequest(artist, offset_next);
+            break;
+          default:
+            break;
+        }
       }
     }
   }
@@ -988,27 +1021,54 @@ void TidalRequest::SongsFinishCheck(const Artist &artist, const Album &album, co
   if (finished_) return;
 
   if (limit == 0 || limit > songs_received) {
-    int offset_next = offset + songs_received;
-    if (offset_next > 0 && offset_next < songs_total) {
-      switch (query_type_) {
-        case Type::FavouriteSongs:
-          AddSongsRequest(offset_next);
-          break;
-        case Type::SearchSongs:
-          // If artist_id and album_id isn't zero it means that it's a songs search where we fetch all albums too. So fallthrough.
-          if (artist.artist_id.isEmpty() && album.album_id.isEmpty()) {
-            AddSongsSearchRequest(offset_next);
+    if (limit == 0 && offset == 0 && songs_received > 0) {
+      // The first page told us the total, request the remaining pages at once so they fetch concurrently.
+      for (int offset_next = songs_received; offset_next < songs_total; offset_next += songs_received) {
+        switch (query_type_) {
+          case Type::FavouriteSongs:
+            AddSongsRequest(offset_next);
             break;
-          }
-          [[fallthrough]];
-        case Type::FavouriteArtists:
-        case Type::SearchArtists:
-        case Type::FavouriteAlbums:
-        case Type::SearchAlbums:
-          AddAlbumSongsRequest(artist, album, offset_next);
-          break;
-        default:
-          break;
+          case Type::SearchSongs:
+            // If artist_id and album_id isn't zero it means that it's a songs search where we fetch all albums too. So fallthrough.
+            if (artist.artist_id.isEmpty() && album.album_id.isEmpty()) {
+              AddSongsSearchRequest(offset_next);
+              break;
+            }
+            [[fallthrough]];
+          case Type::FavouriteArtists:
+          case Type::SearchArtists:
+          case Type::FavouriteAlbums:
+          case Type::SearchAlbums:
+            AddAlbumSongsRequest(artist, album, offset_next);
+            break;
+          default:
+            break;
+        }
+      }
+    }
+    else if (limit > 0) {
+      int offset_next = offset + songs_received;
+      if (offset_next > 0 && offset_next < songs_total) {
+        switch (query_type_) {
+          case Type::FavouriteSongs:
+            AddSongsRequest(offset_next);
+            break;
+          case Type::SearchSongs:
+            // If artist_id and album_id isn't zero it means that it's a songs search where we fetch all albums too. So fallthrough.
+            if (artist.artist_id.isEmpty() && album.album_id.isEmpty()) {
+              AddSongsSearchRequest(offset_next);
+              break;
+            }
+            [[fallthrough]];
+          case Type::FavouriteArtists:
+          case Type::SearchArtists:
+          case Type::FavouriteAlbums:
+          case Type::SearchAlbums:
+            AddAlbumSongsRequest(artist, album, offset_next);
+            break;
+          default:
+            break;
+        }
       }
     }
   }
@@ -1217,6 +1277,18 @@ void TidalRequest::AddAlbumCoverRequest(const Song &song) {
   request.filename = CoverUtils::CoverFilePath(CoverOptions(), song.source(), song.effective_albumartist(), song.effective_album(), song.album_id(), QString(), request.url);
   if (request.filename.isEmpty()) return;
 
+  // A previous sync already downloaded this cover to the same deterministic path, reuse it without a request.
+  if (QFile::exists(request.filename)) {
+    album_covers_requests_sent_.insert(song.album_id(), song.song_id());
+    while (album_covers_requests_sent_.contains(song.album_id())) {
+      const QString song_id = album_covers_requests_sent_.take(song.album_id());
+      if (songs_.contains(song_id)) {
+        songs_[song_id].set_art_automatic(QUrl::fromLocalFile(request.filename));
+      }
+    }
+    return;
+  }
+
   album_covers_requests_sent_.insert(song.album_id(), song.song_id());
   ++album_covers_requests_total_;
 
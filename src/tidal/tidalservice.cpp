@@ -197,6 +197,13 @@ TidalService::TidalService(const SharedPtr<TaskManager> task_manager,
   TidalService::ReloadSettings();
   LoadSession();
 
+  // Warm the resolver for the API host right away, and pre-open the connection once the stored
+  // session is up, so the first stream URL resolution pays neither DNS nor the TCP/TLS handshakes.
+  NetworkAccessManager::PreResolve(QUrl(QLatin1String(kApiUrl)));
+  QTimer::singleShot(3s, this, [this]() {
+    if (authenticated()) network_->PreConnect(QUrl(QLatin1String(kApiUrl)));
+  });
+
 }
 
 TidalService::~TidalService() {
@@ -924,6 +931,11 @@ void TidalService::StartSearch() {
 }
 
 void TidalService::CancelSearch() {
+
+  // Stop a queued search and tear down the in-flight one, the request destructor aborts its network replies.
+  timer_search_delay_->stop();
+  search_request_.reset();
+
 }
 
 void TidalService::SendSearch() {
@@ -41,6 +41,10 @@ TidalUrlHandler::TidalUrlHandler(const SharedPtr<TaskManager> task_manager, Tida
 
 UrlHandler::LoadResult TidalUrlHandler::StartLoading(const QUrl &url) {
 
+  if (const std::optional<LoadResult> cached_result = GetCachedStreamURL(url)) {
+    return *cached_result;
+  }
+
   Request req;
   req.task_id = task_manager_->StartTask(QStringLiteral("Loading %1 stream...").arg(url.scheme()));
   QString error;
@@ -75,7 +79,9 @@ void TidalUrlHandler::GetStreamURLSuccess(const uint id, const QUrl &media_url,
   Request req = requests_.take(id);
   CancelTask(req.task_id);
 
-  Q_EMIT AsyncLoadComplete(LoadResult(media_url, LoadResult::Type::TrackAvailable, stream_url, filetype, samplerate, bit_depth, duration));
+  const LoadResult result(media_url, LoadResult::Type::TrackAvailable, stream_url, filetype, samplerate, bit_depth, duration);
+  CacheStreamURL(result);
+  Q_EMIT AsyncLoadComplete(result);
 
 }
 
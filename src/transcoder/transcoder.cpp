@@ -122,6 +122,10 @@ GstElement *Transcoder::CreateElementForMimeType(GstElementFactoryListType eleme
         if (name.startsWith("avmux"_L1) || name.startsWith("avenc"_L1)) {
           rank = -1;  // ffmpeg usually sucks
         }
+        else if (name == "fdkaacenc"_L1) {
+          // fdk-aac encodes several times faster than the other AAC encoders at better quality, prefer it when installed.
+          rank += 0x100;
+        }
         suitable_elements_ << SuitableElement(name, rank);
       }
     }
@@ -191,7 +195,9 @@ void Transcoder::JobState::PostFinished(const bool success) {
 
 Transcoder::Transcoder(QObject *parent, const QString &settings_postfix)
     : QObject(parent),
-      max_threads_(QThread::idealThreadCount()),
+      // Each transcode pipeline runs its own decode and encode threads inside GStreamer,
+      // so leave one core free for the UI and the pipelines' control loops instead of starting one job per hardware thread.
+      max_threads_(qMax(1, QThread::idealThreadCount() - 1)),
       settings_postfix_(settings_postfix) {
 
   if (JobFinishedEvent::sEventType == -1)
@@ -33,6 +33,13 @@
 
 #include "fileutils.h"
 
+#ifdef Q_OS_LINUX
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/ioctl.h>
+#  include <linux/fs.h>
+#endif
+
 namespace Utilities {
 
 using std::unique_ptr;
@@ -132,4 +139,44 @@ bool RemoveRecursive(const QString &path) {
 
 }
 
+bool CloneOrCopyFile(const QString &source, const QString &destination) {
+
+#ifdef Q_OS_LINUX
+  const int source_fd = open(QFile::encodeName(source).constData(), O_RDONLY | O_CLOEXEC);
+  if (source_fd >= 0) {
+    const int destination_fd = open(QFile::encodeName(destination).constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (destination_fd >= 0) {
+      // Try a reflink first: on filesystems that support it the data is shared, not copied.
+      if (ioctl(destination_fd, FICLONE, source_fd) == 0) {
+        close(destination_fd);
+        close(source_fd);
+        return true;
+      }
+      // Fall back to an in-kernel copy, which avoids bouncing the data through userspace.
+      bool copy_file_range_ok = true;
+      ssize_t copied = 0;
+      do {
+        copied = copy_file_range(source_fd, nullptr, destination_fd, nullptr, 1024 * 1024 * 1024, 0);
+        if (copied < 0) {
+          copy_file_range_ok = false;
+          break;
+        }
+      } while (copied > 0);
+      close(destination_fd);
+      close(source_fd);
+      if (copy_file_range_ok) {
+        return true;
+      }
+      QFile::remove(destination);
+    }
+    else {
+      close(source_fd);
+    }
+  }
+#endif
+
+  return QFile::copy(source, destination);
+
+}
+
 }  // namespace Utilities
@@ -29,6 +29,9 @@ namespace Utilities {
 
 QByteArray ReadDataFromFile(const QString &filename);
 bool Copy(QIODevice *source, QIODevice *destination);
+// Copies a file, using a filesystem clone (reflink) or in-kernel copy when the platform supports it,
+// falling back to a regular copy otherwise.
+bool CloneOrCopyFile(const QString &source, const QString &destination);
 bool CopyRecursive(const QString &source, const QString &destination);
 bool RemoveRecursive(const QString &path);
 
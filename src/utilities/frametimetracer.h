@@ -0,0 +1,70 @@
+/*
+ * Strawberry Music Player
+ * Copyright 2024, Jonas Kvinge <jonas@jkvinge.net>
+ *
+ * Strawberry is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Strawberry is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FRAMETIMETRACER_H
+#define FRAMETIMETRACER_H
+
+#include "config.h"
+
+#include <QtGlobal>
+#include <QString>
+#include <QWidget>
+#include <QPainter>
+#include <QElapsedTimer>
+
+#include "core/logging.h"
+
+// Frame-time overlay and jank tracer for item views, enabled with STRAWBERRY_DEBUG_FRAMETIME.
+// Call FrameStart() at the top of paintEvent and FrameFinished() at the bottom;
+// the last frame's paint time is drawn in the corner of the viewport and frames over a vsync budget are logged.
+class FrameTimeTracer {
+ public:
+  FrameTimeTracer() : last_frame_usec_(0) {}
+
+  static bool enabled() {
+    static const bool enabled = !qEnvironmentVariableIsEmpty("STRAWBERRY_DEBUG_FRAMETIME");
+    return enabled;
+  }
+
+  void FrameStart() {
+    if (enabled()) timer_.start();
+  }
+
+  void FrameFinished(QWidget *viewport, const char *name) {
+
+    if (!enabled() || !timer_.isValid()) return;
+
+    last_frame_usec_ = timer_.nsecsElapsed() / 1000;
+
+    if (last_frame_usec_ > 16000) {
+      qLog(Debug) << name << "frame took" << last_frame_usec_ / 1000 << "ms";
+    }
+
+    QPainter p(viewport);
+    p.setPen(last_frame_usec_ > 16000 ? Qt::red : Qt::darkGreen);
+    p.drawText(viewport->rect().adjusted(0, 0, -4, -4), Qt::AlignRight | Qt::AlignBottom, QStringLiteral("%1.%2 ms").arg(last_frame_usec_ / 1000).arg((last_frame_usec_ % 1000) / 100));
+
+  }
+
+ private:
+  QElapsedTimer timer_;
+  qint64 last_frame_usec_;
+};
+
+#endif  // FRAMETIMETRACER_H
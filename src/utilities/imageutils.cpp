@@ -106,8 +106,14 @@ QImage ImageUtils::ScaleImage(const QImage &image, const QSize desired_size, con
 
   QSize scale_size(static_cast<int>(desired_size.width() * device_pixel_ratio), static_cast<int>(desired_size.height() * device_pixel_ratio));
 
-  // Scale the image
-  QImage image_scaled = image.scaled(scale_size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  // Scale the image. Smooth scaling has vectorized fast paths for 32-bit premultiplied formats, so convert first when needed.
+  QImage image_scaled;
+  if (image.format() == QImage::Format_ARGB32_Premultiplied || image.format() == QImage::Format_RGB32) {
+    image_scaled = image.scaled(scale_size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
+  else {
+    image_scaled = image.convertToFormat(QImage::Format_ARGB32_Premultiplied).scaled(scale_size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
 
   // Pad the image
   if (pad && image_scaled.width() != image_scaled.height()) {
@@ -31,6 +31,9 @@
 #include <QSize>
 #include <QMenu>
 #include <QMovie>
+#include <QtConcurrentRun>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QPainter>
 #include <QTextDocument>
 #include <QTimeLine>
@@ -82,7 +85,8 @@ PlayingWidget::PlayingWidget(QWidget *parent)
       timeline_fade_(new QTimeLine(1000, this)),
       details_(new QTextDocument(this)),
       pixmap_previous_track_opacity_(0.0),
-      downloading_covers_(false) {
+      downloading_covers_(false),
+      scale_cover_request_id_(0) {
 
   SetHeight(0);
 
@@ -341,10 +345,24 @@ void PlayingWidget::SetImage(const QImage &image) {
 
 void PlayingWidget::ScaleCover() {
 
-  QImage image = ImageUtils::ScaleImage(image_original_, QSize(desired_height_, desired_height_), devicePixelRatioF(), true);
-  if (image.isNull()) pixmap_cover_ = QPixmap();
-  else pixmap_cover_ = QPixmap::fromImage(image);
-  update();
+  // Smooth-scaling a large cover takes tens of milliseconds, run it off the UI thread and apply the pixmap when done.
+  const quint64 request_id = ++scale_cover_request_id_;
+  const QImage image_original = image_original_;
+  const QSize desired_size(desired_height_, desired_height_);
+  const qreal device_pixel_ratio = devicePixelRatioF();
+  QFuture<QImage> future = QtConcurrent::run([image_original, desired_size, device_pixel_ratio]() {
+    return ImageUtils::ScaleImage(image_original, desired_size, device_pixel_ratio, true);
+  });
+  QFutureWatcher<QImage> *watcher = new QFutureWatcher<QImage>(this);
+  QObject::connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, request_id]() {
+    const QImage image = watcher->result();
+    watcher->deleteLater();
+    if (request_id != scale_cover_request_id_) return;
+    if (image.isNull()) pixmap_cover_ = QPixmap();
+    else pixmap_cover_ = QPixmap::fromImage(image);
+    update();
+  });
+  watcher->setFuture(future);
 
 }
 
@@ -125,6 +125,8 @@ class PlayingWidget : public QWidget {
   QImage image_current_;
   QImage image_original_;
   QPixmap pixmap_cover_;
+  // Incremented per scale request so a stale background scale result is discarded.
+  quint64 scale_cover_request_id_;
   QPixmap pixmap_previous_track_;
   ScopedPtr<QMovie> spinner_animation_;
 
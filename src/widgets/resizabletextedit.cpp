@@ -46,6 +46,9 @@ void ResizableTextEdit::resizeEvent(QResizeEvent *e) {
 
 void ResizableTextEdit::SetText(const QString &text) {
 
+  // Metadata updates re-set the same text repeatedly; skip the full document relayout when nothing changed.
+  if (text == text_) return;
+
   text_ = text;
 
   QTextEdit::setText(text);
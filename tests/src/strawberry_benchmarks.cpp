@@ -0,0 +1,94 @@
+/* This file is part of Strawberry.
+
+   Strawberry is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   Strawberry is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with Strawberry.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <QString>
+
+#include "analyzer/fht.h"
+#include "core/song.h"
+#include "filterparser/filterparser.h"
+#include "filterparser/filtertree.h"
+
+// Benchmarks for the in-process hot paths that don't need a running application:
+// the analyzer transform, filter parsing and per-song filter evaluation.
+// Build with the strawberry_benchmarks target, which only exists when Google Benchmark is installed.
+
+namespace {
+
+void BM_FHTTransform(benchmark::State &state) {
+
+  FHT fht(9);  // 512 samples
+  std::vector<float> data(static_cast<size_t>(fht.size()), 0.5F);
+
+  for (auto _ : state) {
+    fht.transform(data.data());
+    benchmark::DoNotOptimize(data);
+  }
+
+}
+
+void BM_FHTLogSpectrum(benchmark::State &state) {
+
+  FHT fht(9);
+  std::vector<float> in(static_cast<size_t>(fht.size()), 0.5F);
+  std::vector<float> out(static_cast<size_t>(fht.size()), 0.0F);
+
+  for (auto _ : state) {
+    std::vector<float> scratch = in;
+    fht.logSpectrum(out.data(), scratch.data());
+    benchmark::DoNotOptimize(out);
+  }
+
+}
+
+void BM_FilterParserParse(benchmark::State &state) {
+
+  const QString filter = QStringLiteral("artist:Beatles album:Abbey year:>=1969 love");
+
+  for (auto _ : state) {
+    FilterParser parser(filter);
+    std::unique_ptr<FilterTree> tree(parser.parse());
+    benchmark::DoNotOptimize(tree);
+  }
+
+}
+
+void BM_FilterTreeAccept(benchmark::State &state) {
+
+  FilterParser parser(QStringLiteral("artist:Beatles album:Abbey year:>=1969"));
+  std::unique_ptr<FilterTree> tree(parser.parse());
+
+  Song song;
+  song.Init(QStringLiteral("Come Together"), QStringLiteral("The Beatles"), QStringLiteral("Abbey Road"), 259 * 1000000000LL);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tree->accept(song));
+  }
+
+}
+
+}  // namespace
+
+BENCHMARK(BM_FHTTransform);
+BENCHMARK(BM_FHTLogSpectrum);
+BENCHMARK(BM_FilterParserParse);
+BENCHMARK(BM_FilterTreeAccept);
+
+BENCHMARK_MAIN();